@@ -4,9 +4,11 @@
 // clang-format off
 #include "./s21_containers/s21_rbtree/s21_rbtree.h"
 #include "./s21_containers/s21_vector/s21_vector.h"
+#include "./s21_containers/s21_deque/s21_deque.h"
 #include "./s21_containers/s21_list/s21_list.h"
 #include "./s21_containers/s21_map/s21_map.h"
 // clang-format on
+#include "./s21_containers/s21_priority_queue/s21_priority_queue.h"
 #include "./s21_containers/s21_queue/s21_queue.h"
 #include "./s21_containers/s21_set/s21_set.h"
 #include "./s21_containers/s21_stack/s21_stack.h"
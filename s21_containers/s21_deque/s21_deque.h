@@ -0,0 +1,507 @@
+#ifndef S21_DEQUE_HPP
+#define S21_DEQUE_HPP
+
+#include <stdbool.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_vector/s21_vector.h"
+
+namespace s21 {
+// Elements live in fixed-size chunks reached through a map of chunk
+// pointers. Growing at either end fills the edge chunk or takes a new one;
+// a chunk emptied by a pop goes to a free list and is reused by the next
+// push, so a deque used as a FIFO stops allocating once it reaches its
+// working size. Any push or pop invalidates iterators.
+template <typename T>
+class deque {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+
+  static constexpr size_type chunk_size = [] {
+    size_type n = 16;
+    while (n * 2 * sizeof(T) <= 4096) n *= 2;
+    return n;
+  }();
+
+  template <typename Ref>
+  class basic_iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::remove_reference_t<Ref>*;
+    using reference = Ref;
+
+    basic_iterator() : map(nullptr), pos(0) {}
+    basic_iterator(T* const* chunks, size_type index)
+        : map(chunks), pos(index) {}
+    template <typename Other, typename = std::enable_if_t<
+                                  std::is_convertible<Other, Ref>::value>>
+    basic_iterator(const basic_iterator<Other>& other)
+        : map(other.map), pos(other.pos) {}
+
+    reference operator*() const {
+      return map[pos / chunk_size][pos % chunk_size];
+    }
+    pointer operator->() const { return &**this; }
+    reference operator[](difference_type n) const { return *(*this + n); }
+
+    basic_iterator& operator++() {
+      ++pos;
+      return *this;
+    }
+    basic_iterator operator++(int) {
+      basic_iterator tmp(*this);
+      ++pos;
+      return tmp;
+    }
+    basic_iterator& operator--() {
+      --pos;
+      return *this;
+    }
+    basic_iterator operator--(int) {
+      basic_iterator tmp(*this);
+      --pos;
+      return tmp;
+    }
+    basic_iterator& operator+=(difference_type n) {
+      pos += n;
+      return *this;
+    }
+    basic_iterator& operator-=(difference_type n) {
+      pos -= n;
+      return *this;
+    }
+    basic_iterator operator+(difference_type n) const {
+      return basic_iterator(map, pos + n);
+    }
+    basic_iterator operator-(difference_type n) const {
+      return basic_iterator(map, pos - n);
+    }
+    template <typename Other>
+    difference_type operator-(const basic_iterator<Other>& other) const {
+      return static_cast<difference_type>(pos - other.pos);
+    }
+
+    template <typename Other>
+    bool operator==(const basic_iterator<Other>& other) const {
+      return pos == other.pos;
+    }
+    template <typename Other>
+    bool operator!=(const basic_iterator<Other>& other) const {
+      return pos != other.pos;
+    }
+    template <typename Other>
+    bool operator<(const basic_iterator<Other>& other) const {
+      return pos < other.pos;
+    }
+    template <typename Other>
+    bool operator>(const basic_iterator<Other>& other) const {
+      return pos > other.pos;
+    }
+    template <typename Other>
+    bool operator<=(const basic_iterator<Other>& other) const {
+      return pos <= other.pos;
+    }
+    template <typename Other>
+    bool operator>=(const basic_iterator<Other>& other) const {
+      return pos >= other.pos;
+    }
+
+   private:
+    T* const* map;
+    size_type pos;
+
+    template <typename Other>
+    friend class basic_iterator;
+  };
+
+  using iterator = basic_iterator<reference>;
+  using const_iterator = basic_iterator<const_reference>;
+
+  deque();
+  deque(size_type n);
+  deque(std::initializer_list<value_type> const& items);
+  deque(const deque& other);
+  deque(deque&& other);
+  ~deque();
+
+  deque& operator=(const deque& other);
+  deque& operator=(deque&& other);
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void shrink_to_fit();
+  size_type allocations() const;
+
+  void clear();
+  void push_back(const_reference value);
+  void push_back(value_type&& value);
+  void push_front(const_reference value);
+  void push_front(value_type&& value);
+  void pop_back();
+  void pop_front();
+  void swap(deque& other);
+
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+
+  template <typename... Args>
+  reference emplace_front(Args&&... args);
+
+  template <typename... Args>
+  void insert_many_back(Args&&... args);
+
+  template <typename... Args>
+  void insert_many_front(Args&&... args);
+
+  void print();
+
+ private:
+  struct free_chunk {
+    free_chunk* next;
+  };
+
+  T** map;
+  size_type map_cap;
+  size_type start;
+  size_type sz;
+  free_chunk* spare;
+  size_type allocs;
+
+  T& slot(size_type pos) const;
+  T* take_chunk();
+  void give_chunk(T*& chunk);
+  void grow_map();
+};
+
+template <typename T>
+deque<T>::deque()
+    : map(nullptr),
+      map_cap(0),
+      start(0),
+      sz(0),
+      spare(nullptr),
+      allocs(0) {}
+
+template <typename T>
+deque<T>::deque(size_t n) : deque() {
+  while (n-- > 0) emplace_back();
+}
+
+template <typename T>
+deque<T>::deque(std::initializer_list<T> const& items) : deque() {
+  for (const T& el : items) push_back(el);
+}
+
+template <typename T>
+deque<T>::deque(const deque& other) : deque() {
+  for (const T& el : other) push_back(el);
+}
+
+template <typename T>
+deque<T>::deque(deque&& other) : deque() {
+  swap(other);
+}
+
+template <typename T>
+deque<T>::~deque() {
+  clear();
+  shrink_to_fit();
+  delete[] map;
+}
+
+template <typename T>
+deque<T>& deque<T>::operator=(const deque& other) {
+  if (this != &other) {
+    deque tmp(other);
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename T>
+deque<T>& deque<T>::operator=(deque&& other) {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename T>
+T& deque<T>::at(size_type pos) {
+  if (pos >= sz) throw std::out_of_range("Index out of range");
+  return slot(start + pos);
+}
+
+template <typename T>
+const T& deque<T>::at(size_type pos) const {
+  if (pos >= sz) throw std::out_of_range("Index out of range");
+  return slot(start + pos);
+}
+
+template <typename T>
+T& deque<T>::operator[](size_type pos) {
+  return slot(start + pos);
+}
+
+template <typename T>
+const T& deque<T>::operator[](size_type pos) const {
+  return slot(start + pos);
+}
+
+template <typename T>
+T& deque<T>::front() {
+  return at(0);
+}
+
+template <typename T>
+const T& deque<T>::front() const {
+  return at(0);
+}
+
+template <typename T>
+T& deque<T>::back() {
+  if (sz == 0) throw std::out_of_range("Index out of range");
+  return slot(start + sz - 1);
+}
+
+template <typename T>
+const T& deque<T>::back() const {
+  if (sz == 0) throw std::out_of_range("Index out of range");
+  return slot(start + sz - 1);
+}
+
+template <typename T>
+typename deque<T>::iterator deque<T>::begin() {
+  return iterator(map, start);
+}
+
+template <typename T>
+typename deque<T>::iterator deque<T>::end() {
+  return iterator(map, start + sz);
+}
+
+template <typename T>
+typename deque<T>::const_iterator deque<T>::begin() const {
+  return const_iterator(map, start);
+}
+
+template <typename T>
+typename deque<T>::const_iterator deque<T>::end() const {
+  return const_iterator(map, start + sz);
+}
+
+template <typename T>
+bool deque<T>::empty() const {
+  return sz == 0;
+}
+
+template <typename T>
+size_t deque<T>::size() const {
+  return sz;
+}
+
+template <typename T>
+size_t deque<T>::max_size() const {
+  return std::numeric_limits<std::size_t>::max() / sizeof(T) / 2;
+}
+
+// Returns the recycled chunks to the allocator; chunks still reachable from
+// the map are kept.
+template <typename T>
+void deque<T>::shrink_to_fit() {
+  while (spare) {
+    free_chunk* next = spare->next;
+    aligned_memory<>::deallocate(spare, chunk_size * sizeof(T), alignof(T));
+    spare = next;
+  }
+}
+
+template <typename T>
+size_t deque<T>::allocations() const {
+  return allocs;
+}
+
+template <typename T>
+void deque<T>::clear() {
+  if (!std::is_trivially_destructible<T>::value)
+    for (size_type i = 0; i < sz; ++i) slot(start + i).~T();
+  for (size_type i = 0; i < map_cap; ++i)
+    if (map[i]) give_chunk(map[i]);
+  start = map_cap * chunk_size / 2;
+  sz = 0;
+}
+
+template <typename T>
+void deque<T>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T>
+void deque<T>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T>
+void deque<T>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+template <typename T>
+void deque<T>::push_front(value_type&& value) {
+  emplace_front(std::move(value));
+}
+
+template <typename T>
+void deque<T>::pop_back() {
+  if (sz > 0) {
+    size_type pos = start + --sz;
+    slot(pos).~T();
+    if (pos % chunk_size == 0) give_chunk(map[pos / chunk_size]);
+  }
+}
+
+template <typename T>
+void deque<T>::pop_front() {
+  if (sz > 0) {
+    size_type pos = start++;
+    --sz;
+    slot(pos).~T();
+    if ((pos + 1) % chunk_size == 0) give_chunk(map[pos / chunk_size]);
+  }
+}
+
+template <typename T>
+void deque<T>::swap(deque& other) {
+  std::swap(map, other.map);
+  std::swap(map_cap, other.map_cap);
+  std::swap(start, other.start);
+  std::swap(sz, other.sz);
+  std::swap(spare, other.spare);
+  std::swap(allocs, other.allocs);
+}
+
+template <typename T>
+template <typename... Args>
+T& deque<T>::emplace_back(Args&&... args) {
+  if (start + sz == map_cap * chunk_size) grow_map();
+  size_type pos = start + sz;
+  T*& chunk = map[pos / chunk_size];
+  if (!chunk) chunk = take_chunk();
+  T* res = new (chunk + pos % chunk_size) T(std::forward<Args>(args)...);
+  ++sz;
+  return *res;
+}
+
+template <typename T>
+template <typename... Args>
+T& deque<T>::emplace_front(Args&&... args) {
+  if (start == 0) grow_map();
+  size_type pos = start - 1;
+  T*& chunk = map[pos / chunk_size];
+  if (!chunk) chunk = take_chunk();
+  T* res = new (chunk + pos % chunk_size) T(std::forward<Args>(args)...);
+  start = pos;
+  ++sz;
+  return *res;
+}
+
+template <typename T>
+template <typename... Args>
+void deque<T>::insert_many_back(Args&&... args) {
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+template <typename T>
+template <typename... Args>
+void deque<T>::insert_many_front(Args&&... args) {
+  (emplace_front(std::forward<Args>(args)), ...);
+  std::reverse(begin(), begin() + sizeof...(Args));
+}
+
+template <typename T>
+T& deque<T>::slot(size_type pos) const {
+  return map[pos / chunk_size][pos % chunk_size];
+}
+
+template <typename T>
+T* deque<T>::take_chunk() {
+  if (spare) {
+    free_chunk* res = spare;
+    spare = spare->next;
+    return reinterpret_cast<T*>(res);
+  }
+  void* mem = aligned_memory<>::allocate(chunk_size * sizeof(T), alignof(T));
+  ++allocs;
+  return static_cast<T*>(mem);
+}
+
+template <typename T>
+void deque<T>::give_chunk(T*& chunk) {
+  free_chunk* freed = reinterpret_cast<free_chunk*>(chunk);
+  freed->next = spare;
+  spare = freed;
+  chunk = nullptr;
+}
+
+// Re-centres the occupied chunks in a map that has at least as many free
+// slots as used ones, doubling the map when the current one is too full.
+template <typename T>
+void deque<T>::grow_map() {
+  size_type first = start / chunk_size;
+  size_type used = sz ? (start + sz - 1) / chunk_size - first + 1 : 0;
+  size_type new_cap = map_cap;
+  if (2 * (used + 1) > map_cap) new_cap = std::max<size_type>(2 * map_cap, 8);
+  T** new_map = new T*[new_cap]();
+  size_type new_first = (new_cap - used) / 2;
+  for (size_type i = 0; i < map_cap; ++i) {
+    if (i >= first && i < first + used)
+      new_map[new_first + i - first] = map[i];
+    else if (map[i])
+      give_chunk(map[i]);
+  }
+  delete[] map;
+  map = new_map;
+  map_cap = new_cap;
+  start = new_first * chunk_size + start % chunk_size;
+}
+
+template <typename T>
+void deque<T>::print() {
+  std::cout << "size: " << sz << '\n';
+  for (const T& el : *this) std::cout << el << ' ';
+  std::cout << "\n\n";
+}
+}  // namespace s21
+
+#endif
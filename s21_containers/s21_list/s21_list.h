@@ -3,11 +3,147 @@
 
 #include <stdbool.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
 #include <iostream>
 #include <limits>
+#include <new>
+#include <type_traits>
 #include <utility>
 
 namespace s21 {
+// Hands out node-sized slots carved from geometrically growing chunks and
+// recycles freed slots through an intrusive free list. A pool belongs to one
+// list, which alone allocates from it and frees into the plain free list;
+// spliced nodes may die in another list, possibly on another thread, and go
+// back through a lock-free stack that the owner drains when its own free
+// list runs dry. The pool deletes itself once its owner has released it and
+// every slot it handed out has come back, so a moved node keeps its chunks
+// alive for exactly as long as it lives.
+template <typename Node>
+class node_pool {
+ public:
+  using size_type = size_t;
+
+  static node_pool* create();
+  void release(size_type discarded);
+
+  Node* allocate();
+  void deallocate(Node* ptr);
+  void deallocate_remote(Node* ptr);
+  size_type chunks() const;
+
+ private:
+  union slot {
+    slot* next;
+    alignas(Node) unsigned char storage[sizeof(Node)];
+  };
+
+  static constexpr size_type first_chunk = 16;
+  static constexpr size_type max_chunk = 4096;
+
+  slot* free_list;
+  slot* chunk_list;
+  slot* bump;
+  slot* bump_end;
+  size_type next_chunk;
+  size_type chunk_count;
+  size_type live;
+  std::atomic<slot*> remote_free;
+  std::atomic<std::ptrdiff_t> outstanding;
+
+  node_pool();
+  ~node_pool();
+};
+
+template <typename Node>
+node_pool<Node>::node_pool()
+    : free_list(nullptr),
+      chunk_list(nullptr),
+      bump(nullptr),
+      bump_end(nullptr),
+      next_chunk(first_chunk),
+      chunk_count(0),
+      live(0),
+      remote_free(nullptr),
+      outstanding(0) {}
+
+template <typename Node>
+node_pool<Node>::~node_pool() {
+  while (chunk_list) {
+    slot* next = chunk_list->next;
+    delete[] chunk_list;
+    chunk_list = next;
+  }
+}
+
+template <typename Node>
+node_pool<Node>* node_pool<Node>::create() {
+  return new node_pool();
+}
+
+// Called by the owner, which drops discarded of its live nodes along with
+// the pool. Remote frees count outstanding down from zero, so it can only
+// reach zero again once the owner has added the nodes still out elsewhere.
+template <typename Node>
+void node_pool<Node>::release(size_type discarded) {
+  std::ptrdiff_t out = static_cast<std::ptrdiff_t>(live - discarded);
+  if (outstanding.fetch_add(out, std::memory_order_acq_rel) + out == 0)
+    delete this;
+}
+
+template <typename Node>
+Node* node_pool<Node>::allocate() {
+  slot* res = free_list;
+  if (!res && remote_free.load(std::memory_order_relaxed))
+    res = remote_free.exchange(nullptr, std::memory_order_acquire);
+  if (res) {
+    free_list = res->next;
+  } else {
+    if (bump == bump_end) {
+      slot* chunk = new slot[next_chunk + 1];
+      chunk->next = chunk_list;
+      chunk_list = chunk;
+      bump = chunk + 1;
+      bump_end = chunk + next_chunk + 1;
+      next_chunk = std::min(2 * next_chunk, max_chunk);
+      ++chunk_count;
+    }
+    res = bump++;
+  }
+  ++live;
+  return reinterpret_cast<Node*>(res->storage);
+}
+
+template <typename Node>
+void node_pool<Node>::deallocate(Node* ptr) {
+  slot* freed = reinterpret_cast<slot*>(ptr);
+  freed->next = free_list;
+  free_list = freed;
+  --live;
+}
+
+// Any thread. The stack is only ever emptied as a whole, so pushes need no
+// ABA protection.
+template <typename Node>
+void node_pool<Node>::deallocate_remote(Node* ptr) {
+  slot* freed = reinterpret_cast<slot*>(ptr);
+  slot* head = remote_free.load(std::memory_order_relaxed);
+  do {
+    freed->next = head;
+  } while (!remote_free.compare_exchange_weak(head, freed,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed));
+  if (outstanding.fetch_sub(1, std::memory_order_acq_rel) == 1) delete this;
+}
+
+template <typename Node>
+size_t node_pool<Node>::chunks() const {
+  return chunk_count;
+}
+
 template <typename T>
 class list {
  public:
@@ -20,11 +156,15 @@ class list {
     value_type value;
     node* next_node;
     node* prev_node;
+    node_pool<node>* home;
 
    public:
-    node() : value(0), next_node(nullptr), prev_node(nullptr) {}
-    node(value_type value)
-        : value(value), next_node(nullptr), prev_node(nullptr) {}
+    template <typename... Args>
+    node(Args&&... args)
+        : value(std::forward<Args>(args)...),
+          next_node(nullptr),
+          prev_node(nullptr),
+          home(nullptr) {}
     friend class list;
   };
 
@@ -32,8 +172,8 @@ class list {
    public:
     const_iterator() : ptr(nullptr) {}
     const_iterator(node* tmp) : ptr(tmp) {}
-    const_iterator(const_iterator& other) : ptr(other.ptr) {}
-    const_iterator& operator=(const_iterator& other) {
+    const_iterator(const const_iterator& other) : ptr(other.ptr) {}
+    const_iterator& operator=(const const_iterator& other) {
       ptr = other.ptr;
       return *this;
     }
@@ -136,7 +276,9 @@ class list {
   iterator begin();
   iterator end();
 
+  reference front();
   const_reference front() const;
+  reference back();
   const_reference back() const;
 
   bool empty() const;
@@ -145,17 +287,35 @@ class list {
 
   void clear();
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type&& value);
   void erase(iterator pos);
   void push_back(const_reference data);
+  void push_back(value_type&& data);
   void push_front(const_reference data);
+  void push_front(value_type&& data);
   void pop_front();
   void pop_back();
   void swap(list& other);
   void merge(list& other);
+  template <typename Compare>
+  void merge(list& other, Compare comp);
   void splice(iterator pos, list& other);
+  void splice(iterator pos, list& other, iterator it);
+  void splice(iterator pos, list& other, iterator first, iterator last);
   void reverse();
   void unique();
   void sort();
+  template <typename Compare>
+  void sort(Compare comp);
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
+
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+
+  template <typename... Args>
+  reference emplace_front(Args&&... args);
 
   template <typename... Args>
   iterator insert_many(const_iterator cpos, Args&&... args);
@@ -173,10 +333,22 @@ class list {
   node* tail;
   node* stub;
   size_type sz;
+  node_pool<node>* pool;
+
+  template <typename... Args>
+  node* create_node(Args&&... args);
+  void destroy_node(node* ptr);
+  void detach(node* first, node* last);
+  void attach(node* pos, node* first, node* last);
+
+  template <typename Compare>
+  static node* merge_runs(node* a, node* b, Compare& comp);
+  template <typename Compare>
+  static node* take_run(node*& rest, Compare& comp);
 };
 
 template <typename T>
-list<T>::list() {
+list<T>::list() : pool(nullptr) {
   stub = new node;
   head = tail = stub;
   sz = 0;
@@ -185,12 +357,12 @@ list<T>::list() {
 template <typename T>
 list<T>::list(size_t n) : list() {
   if (n < 0) throw std::out_of_range("Index out of range");
-  while (n-- > 0) push_back(T());
+  while (n-- > 0) emplace_back();
 }
 
 template <typename T>
 list<T>::list(std::initializer_list<T> const& items) : list() {
-  for (T el : items) push_back(el);
+  for (const T& el : items) push_back(el);
 }
 
 template <typename T>
@@ -200,26 +372,34 @@ list<T>::list(const list& other) : list() {
 
 template <typename T>
 list<T>::list(list&& other)
-    : head(other.head), tail(other.tail), stub(other.stub), sz(other.sz) {
+    : head(other.head),
+      tail(other.tail),
+      stub(other.stub),
+      sz(other.sz),
+      pool(other.pool) {
   if (this != &other) {
     other.sz = 0;
     other.head = nullptr;
     other.tail = nullptr;
     other.stub = nullptr;
+    other.pool = nullptr;
   }
 }
 
 template <typename T>
 list<T>::~list() {
   clear();
+  delete stub;
 }
 
 template <typename T>
 list<T>& list<T>::operator=(const list& other) {
   if (this != &other) {
     clear();
-    stub = new node;
-    head = tail = stub;
+    if (!stub) {
+      stub = new node;
+      head = tail = stub;
+    }
     node* tmp_node = other.head;
     while (tmp_node != other.stub) {
       push_back(tmp_node->value);
@@ -231,36 +411,22 @@ list<T>& list<T>::operator=(const list& other) {
 
 template <typename T>
 void list<T>::push_front(const T& data) {
-  node* new_ptr = new node(data);
-  if (head != stub) {
-    head->prev_node = new_ptr;
-    new_ptr->next_node = head;
-    head = new_ptr;
-  } else {
-    head = new_ptr;
-    tail = new_ptr;
-    tail->next_node = stub;
-    stub->prev_node = tail;
-  }
-  ++sz;
-  return;
+  emplace_front(data);
+}
+
+template <typename T>
+void list<T>::push_front(T&& data) {
+  emplace_front(std::move(data));
 }
 
 template <typename T>
 void list<T>::push_back(const T& data) {
-  node* new_ptr = new node(data);
-  if (tail != stub) {
-    tail->next_node = new_ptr;
-    new_ptr->prev_node = tail;
-    tail = new_ptr;
-  } else {
-    head = new_ptr;
-    tail = new_ptr;
-  }
-  tail->next_node = stub;
-  stub->prev_node = tail;
-  ++sz;
-  return;
+  emplace_back(data);
+}
+
+template <typename T>
+void list<T>::push_back(T&& data) {
+  emplace_back(std::move(data));
 }
 
 template <typename T>
@@ -270,7 +436,7 @@ void list<T>::pop_front() {
     head = head->next_node;
     head->prev_node = nullptr;
     if (tail == prev_head) tail = stub;
-    delete prev_head;
+    destroy_node(prev_head);
     --sz;
   }
 }
@@ -286,8 +452,9 @@ void list<T>::pop_back() {
     } else {
       tail = stub;
       head = stub;
+      stub->prev_node = nullptr;
     }
-    delete prev_tail;
+    destroy_node(prev_tail);
     --sz;
   }
 }
@@ -302,11 +469,21 @@ typename list<T>::iterator list<T>::end() {
   return iterator(stub);
 }
 
+template <typename T>
+T& list<T>::front() {
+  return head->value;
+}
+
 template <typename T>
 const T& list<T>::front() const {
   return head->value;
 }
 
+template <typename T>
+T& list<T>::back() {
+  return tail->value;
+}
+
 template <typename T>
 const T& list<T>::back() const {
   return tail->value;
@@ -327,34 +504,38 @@ size_t list<T>::max_size() const {
   return (std::numeric_limits<std::size_t>::max() / sizeof(node) / 2);
 }
 
+// Nodes from this list's own pool are dropped together with it; nodes that
+// were spliced in from other lists go back to the pools they came from.
 template <typename T>
 void list<T>::clear() {
-  while (sz != 0) pop_front();
-  delete stub;
-  stub = nullptr;
+  size_type own = 0;
+  for (node* it = head; it != stub;) {
+    node* next = it->next_node;
+    node_pool<node>* home = it->home;
+    it->~node();
+    if (home == pool)
+      ++own;
+    else
+      home->deallocate_remote(it);
+    it = next;
+  }
+  if (stub) {
+    head = tail = stub;
+    stub->prev_node = nullptr;
+  }
+  sz = 0;
+  if (pool) pool->release(own);
+  pool = nullptr;
 }
 
 template <typename T>
 typename list<T>::iterator list<T>::insert(iterator pos, const T& value) {
-  node* tmp = pos.ptr;
-  node* new_ptr = nullptr;
-  if (tmp) {
-    if (tmp == stub) {
-      push_back(value);
-      new_ptr = stub->prev_node;
-    } else if (tmp == head) {
-      push_front(value);
-      new_ptr = head;
-    } else {
-      new_ptr = new node(value);
-      new_ptr->next_node = tmp;
-      new_ptr->prev_node = tmp->prev_node;
-      tmp->prev_node->next_node = new_ptr;
-      tmp->prev_node = new_ptr;
-      ++sz;
-    }
-  }
-  return iterator(new_ptr);
+  return emplace(pos, value);
+}
+
+template <typename T>
+typename list<T>::iterator list<T>::insert(iterator pos, T&& value) {
+  return emplace(pos, std::move(value));
 }
 
 template <typename T>
@@ -369,7 +550,7 @@ void list<T>::erase(iterator pos) {
       tmp->prev_node->next_node = tmp->next_node;
       tmp->next_node->prev_node = tmp->prev_node;
       --sz;
-      delete tmp;
+      destroy_node(tmp);
     }
   }
   return;
@@ -381,15 +562,82 @@ void list<T>::swap(list& other) {
   std::swap(head, other.head);
   std::swap(tail, other.tail);
   std::swap(stub, other.stub);
+  std::swap(pool, other.pool);
 }
 
 template <typename T>
 void list<T>::sort() {
-  if (sz >= 2) {
-    for (node* it1 = head; it1 != tail; it1 = it1->next_node)
-      for (node* it2 = it1->next_node; it2 != stub; it2 = it2->next_node)
-        if (it1->value > it2->value) std::swap(it1->value, it2->value);
+  sort(std::less<T>());
+}
+
+// Bottom-up natural merge sort: runs already present in the input are merged
+// through a binary counter of bins, so sorted input costs a single pass.
+// Nodes are relinked, never copied, and equal elements keep their order.
+template <typename T>
+template <typename Compare>
+void list<T>::sort(Compare comp) {
+  if (sz < 2) return;
+  tail->next_node = nullptr;
+  node* bins[64] = {};
+  node* rest = head;
+  while (rest) {
+    node* run = take_run(rest, comp);
+    size_t i = 0;
+    for (; bins[i]; ++i) {
+      run = merge_runs(bins[i], run, comp);
+      bins[i] = nullptr;
+    }
+    bins[i] = run;
+  }
+  node* res = nullptr;
+  for (node* bin : bins)
+    if (bin) res = res ? merge_runs(bin, res, comp) : bin;
+  head = res;
+  head->prev_node = nullptr;
+  for (tail = head; tail->next_node; tail = tail->next_node)
+    tail->next_node->prev_node = tail;
+  tail->next_node = stub;
+  stub->prev_node = tail;
+}
+
+// Detaches the longest non-descending or strictly descending prefix of rest
+// (the latter reversed) and returns it as a null-terminated chain.
+template <typename T>
+template <typename Compare>
+typename list<T>::node* list<T>::take_run(node*& rest, Compare& comp) {
+  node* run = rest;
+  node* last = run;
+  if (last->next_node && comp(last->next_node->value, last->value)) {
+    rest = last->next_node;
+    run->next_node = nullptr;
+    while (rest && comp(rest->value, last->value)) {
+      node* next = rest->next_node;
+      rest->next_node = run;
+      last = run = rest;
+      rest = next;
+    }
+    return run;
   }
+  while (last->next_node && !comp(last->next_node->value, last->value))
+    last = last->next_node;
+  rest = last->next_node;
+  last->next_node = nullptr;
+  return run;
+}
+
+template <typename T>
+template <typename Compare>
+typename list<T>::node* list<T>::merge_runs(node* a, node* b, Compare& comp) {
+  node* res = nullptr;
+  node** link = &res;
+  while (a && b) {
+    node*& from = comp(b->value, a->value) ? b : a;
+    *link = from;
+    link = &from->next_node;
+    from = from->next_node;
+  }
+  *link = a ? a : b;
+  return res;
 }
 
 template <typename T>
@@ -413,70 +661,192 @@ void list<T>::unique() {
 template <typename T>
 void list<T>::reverse() {
   if (sz >= 2) {
-    auto it1 = begin();
-    auto it2 = end();
-    --it2;
-    for (; (it1 != it2) && (it1.ptr->prev_node != it2.ptr); ++it1, --it2)
-      std::swap(it1.ptr->value, it2.ptr->value);
+    for (node* it = head; it != stub; it = it->prev_node)
+      std::swap(it->next_node, it->prev_node);
+    std::swap(head, tail);
+    head->prev_node = nullptr;
+    tail->next_node = stub;
+    stub->prev_node = tail;
   }
 }
 
 template <typename T>
 void list<T>::merge(list& other) {
-  if (this != &other) {
-    auto it1 = begin();
-    auto it2 = other.begin();
-    while ((it1 != end()) && (it2 != other.end())) {
-      if ((it1 == end()) || (*it2 < *it1)) {
-        it1 = insert(it1, *it2);
-        ++it1;
-        ++it2;
-      } else
-        ++it1;
+  merge(other, std::less<T>());
+}
+
+// Relinks the nodes of other into this list; equal elements of this list
+// stay in front of those taken from other. The sizes follow every moved
+// run, so both lists stay consistent if comp throws.
+template <typename T>
+template <typename Compare>
+void list<T>::merge(list& other, Compare comp) {
+  if (this != &other && other.sz > 0) {
+    node* it1 = head;
+    while (other.head != other.stub) {
+      while (it1 != stub && !comp(other.head->value, it1->value))
+        it1 = it1->next_node;
+      node* first = other.head;
+      node* last = first;
+      size_type count = 1;
+      if (it1 == stub) {
+        last = other.tail;
+        count = other.sz;
+      } else {
+        while (last->next_node != other.stub &&
+               comp(last->next_node->value, it1->value)) {
+          last = last->next_node;
+          ++count;
+        }
+      }
+      other.detach(first, last);
+      attach(it1, first, last);
+      other.sz -= count;
+      sz += count;
     }
-    other.clear();
-    other.head = other.tail = other.stub = new node();
   }
 }
 
+// Splicing only relinks: every node remembers the pool it came from and is
+// freed back into it wherever it dies, so nothing is recorded or allocated
+// and nothing can throw. The range overload still counts the moved nodes
+// when other is a different list.
 template <typename T>
 void list<T>::splice(iterator pos, list& other) {
+  if (this != &other && other.sz > 0) {
+    node* first = other.head;
+    node* last = other.tail;
+    other.detach(first, last);
+    attach(pos.ptr, first, last);
+    sz += other.sz;
+    other.sz = 0;
+  }
+}
+
+template <typename T>
+void list<T>::splice(iterator pos, list& other, iterator it) {
+  node* moved = it.ptr;
+  if (moved == other.stub || moved == pos.ptr || moved->next_node == pos.ptr)
+    return;
+  other.detach(moved, moved);
+  attach(pos.ptr, moved, moved);
   if (this != &other) {
-    for (auto it = other.begin(); it != other.end(); ++it, ++pos)
-      pos = insert(pos, *it);
-    other.clear();
-    other.head = other.tail = other.stub = new node();
+    --other.sz;
+    ++sz;
   }
 }
 
+template <typename T>
+void list<T>::splice(iterator pos, list& other, iterator first,
+                     iterator last) {
+  if (first == last) return;
+  node* last_node = last.ptr->prev_node;
+  if (this != &other) {
+    size_type count = 1;
+    for (node* it = first.ptr; it != last_node; it = it->next_node) ++count;
+    other.sz -= count;
+    sz += count;
+  }
+  other.detach(first.ptr, last_node);
+  attach(pos.ptr, first.ptr, last_node);
+}
+
+template <typename T>
+template <typename... Args>
+typename list<T>::iterator list<T>::emplace(const_iterator pos,
+                                            Args&&... args) {
+  node* new_ptr = nullptr;
+  if (pos.get_iter()) {
+    new_ptr = create_node(std::forward<Args>(args)...);
+    attach(pos.get_iter(), new_ptr, new_ptr);
+    ++sz;
+  }
+  return iterator(new_ptr);
+}
+
+template <typename T>
+template <typename... Args>
+T& list<T>::emplace_back(Args&&... args) {
+  return *emplace(end(), std::forward<Args>(args)...);
+}
+
+template <typename T>
+template <typename... Args>
+T& list<T>::emplace_front(Args&&... args) {
+  return *emplace(begin(), std::forward<Args>(args)...);
+}
+
 template <typename T>
 template <typename... Args>
 typename list<T>::iterator list<T>::insert_many(const_iterator cpos,
                                                 Args&&... args) {
-  list local_list{args...};
-  iterator pos;
-  for (auto it = local_list.begin(); it != local_list.end(); ++it) {
-    pos = iterator(cpos.get_iter());
-    insert(pos, *it);
-  }
-  return pos;
+  (emplace(cpos, std::forward<Args>(args)), ...);
+  return iterator(cpos.get_iter());
 }
 
 template <typename T>
 template <typename... Args>
 void list<T>::insert_many_back(Args&&... args) {
-  list local_list{args...};
-  for (auto it = local_list.begin(); it != local_list.end(); ++it)
-    push_back(*it);
+  (emplace_back(std::forward<Args>(args)), ...);
 }
 
 template <typename T>
 template <typename... Args>
 void list<T>::insert_many_front(Args&&... args) {
-  list local_list{args...};
-  iterator pos = begin();
-  for (auto it = local_list.begin(); it != local_list.end(); ++it)
-    insert(pos, *it);
+  insert_many(begin(), std::forward<Args>(args)...);
+}
+
+template <typename T>
+template <typename... Args>
+typename list<T>::node* list<T>::create_node(Args&&... args) {
+  if (!pool) pool = node_pool<node>::create();
+  node* mem = pool->allocate();
+  node* res;
+  try {
+    res = new (mem) node(std::forward<Args>(args)...);
+  } catch (...) {
+    pool->deallocate(mem);
+    throw;
+  }
+  res->home = pool;
+  return res;
+}
+
+template <typename T>
+void list<T>::destroy_node(node* ptr) {
+  node_pool<node>* home = ptr->home;
+  ptr->~node();
+  if (home == pool)
+    pool->deallocate(ptr);
+  else
+    home->deallocate_remote(ptr);
+}
+
+// Unlinks the chain [first, last] without freeing it.
+template <typename T>
+void list<T>::detach(node* first, node* last) {
+  node* before = (first == head) ? nullptr : first->prev_node;
+  node* after = last->next_node;
+  if (before)
+    before->next_node = after;
+  else
+    head = after;
+  after->prev_node = before;
+  if (tail == last) tail = before ? before : stub;
+}
+
+// Links the chain [first, last] in front of pos.
+template <typename T>
+void list<T>::attach(node* pos, node* first, node* last) {
+  node* before = (pos == head) ? nullptr : pos->prev_node;
+  first->prev_node = before;
+  last->next_node = pos;
+  pos->prev_node = last;
+  if (before)
+    before->next_node = first;
+  else
+    head = first;
+  if (pos == stub) tail = last;
 }
 
 template <typename T>
@@ -0,0 +1,505 @@
+#ifndef S21_PRIORITY_QUEUE_HPP
+#define S21_PRIORITY_QUEUE_HPP
+
+#include <stdbool.h>
+
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+#include "../s21_vector/s21_vector.h"
+
+namespace s21 {
+namespace dary_heap {
+// Sift routines for an implicit D-ary heap in which comp(a, b) means a
+// ranks below b. They move a hole instead of swapping, and call placed(i)
+// for every element that lands at index i, so a caller can track where its
+// elements are.
+template <size_t D, typename T, typename Compare, typename Placed>
+size_t sift_up(T* heap, size_t i, Compare& comp, Placed placed) {
+  T hole = std::move(heap[i]);
+  while (i > 0) {
+    size_t parent = (i - 1) / D;
+    if (!comp(heap[parent], hole)) break;
+    heap[i] = std::move(heap[parent]);
+    placed(i);
+    i = parent;
+  }
+  heap[i] = std::move(hole);
+  placed(i);
+  return i;
+}
+
+// All D children of a node are adjacent, so picking the best one reads a
+// single cache line for small T.
+template <size_t D, typename T, typename Compare, typename Placed>
+size_t sift_down(T* heap, size_t n, size_t i, Compare& comp, Placed placed) {
+  T hole = std::move(heap[i]);
+  for (;;) {
+    size_t first = D * i + 1;
+    if (first >= n) break;
+    size_t last = first + D < n ? first + D : n;
+    size_t best = first;
+    for (size_t c = first + 1; c < last; ++c)
+      if (comp(heap[best], heap[c])) best = c;
+    if (!comp(hole, heap[best])) break;
+    heap[i] = std::move(heap[best]);
+    placed(i);
+    i = best;
+  }
+  heap[i] = std::move(hole);
+  placed(i);
+  return i;
+}
+
+// Floyd's bottom-up construction, O(n).
+template <size_t D, typename T, typename Compare, typename Placed>
+void make(T* heap, size_t n, Compare& comp, Placed placed) {
+  if (n < 2) {
+    for (size_t i = 0; i < n; ++i) placed(i);
+    return;
+  }
+  for (size_t i = (n - 2) / D + 1; i < n; ++i) placed(i);
+  for (size_t i = (n - 2) / D + 1; i-- > 0;)
+    sift_down<D>(heap, n, i, comp, placed);
+}
+
+// Appending k elements to a heap of n: k sift-ups cost about k * depth
+// comparisons, a rebuild about n + k.
+template <size_t D>
+bool rebuild_cheaper(size_t n, size_t k) {
+  size_t depth = 1;
+  for (size_t level = D; level < n + k; level *= D) ++depth;
+  return k * depth > n + k;
+}
+
+struct no_tracking {
+  void operator()(size_t) const {}
+};
+}  // namespace dary_heap
+
+// Adaptor keeping the largest element (by Compare) on top, stored as a
+// D-ary heap in a contiguous vector. A wider node makes the tree shallower
+// and keeps siblings together, which suits pop-heavy workloads; D = 2 is
+// the classic binary heap.
+template <typename T, typename Compare = std::less<T>, size_t D = 4>
+class priority_queue {
+  static_assert(D >= 2, "heap arity must be at least 2");
+
+ public:
+  using container_type = vector<T>;
+  using value_compare = Compare;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  priority_queue();
+  explicit priority_queue(const Compare& comp);
+  priority_queue(std::initializer_list<value_type> const& items);
+  template <typename InputIt>
+  priority_queue(InputIt first, InputIt last, const Compare& comp = Compare());
+  priority_queue(const priority_queue& q);
+  priority_queue(priority_queue&& q);
+  ~priority_queue();
+  priority_queue& operator=(priority_queue&& q);
+
+  const_reference top() const;
+  bool empty() const;
+  size_type size() const;
+  void reserve(size_type size);
+
+  void push(const_reference value);
+  void push(value_type&& value);
+  template <typename... Args>
+  void emplace(Args&&... args);
+  template <typename InputIt>
+  void push_range(InputIt first, InputIt last);
+  void pop();
+  void swap(priority_queue& other);
+  void clear();
+
+  template <typename... Args>
+  void insert_many(Args&&... args);
+
+  void print();
+
+ private:
+  container_type c;
+  Compare comp;
+
+  void sift_up(size_type i);
+  void sift_down(size_type i);
+  void rebuild();
+};
+
+template <typename T, typename Compare, size_t D>
+priority_queue<T, Compare, D>::priority_queue() : c(), comp() {}
+
+template <typename T, typename Compare, size_t D>
+priority_queue<T, Compare, D>::priority_queue(const Compare& comp)
+    : c(), comp(comp) {}
+
+template <typename T, typename Compare, size_t D>
+priority_queue<T, Compare, D>::priority_queue(
+    std::initializer_list<T> const& items)
+    : priority_queue(items.begin(), items.end()) {}
+
+template <typename T, typename Compare, size_t D>
+template <typename InputIt>
+priority_queue<T, Compare, D>::priority_queue(InputIt first, InputIt last,
+                                              const Compare& comp)
+    : c(), comp(comp) {
+  c.assign(first, last);
+  rebuild();
+}
+
+template <typename T, typename Compare, size_t D>
+priority_queue<T, Compare, D>::priority_queue(const priority_queue& q)
+    : c(q.c), comp(q.comp) {}
+
+template <typename T, typename Compare, size_t D>
+priority_queue<T, Compare, D>::priority_queue(priority_queue&& q)
+    : c(std::move(q.c)), comp(std::move(q.comp)) {}
+
+template <typename T, typename Compare, size_t D>
+priority_queue<T, Compare, D>::~priority_queue() {}
+
+template <typename T, typename Compare, size_t D>
+priority_queue<T, Compare, D>& priority_queue<T, Compare, D>::operator=(
+    priority_queue&& q) {
+  if (this != &q) {
+    c = std::move(q.c);
+    comp = std::move(q.comp);
+  }
+  return *this;
+}
+
+template <typename T, typename Compare, size_t D>
+const T& priority_queue<T, Compare, D>::top() const {
+  if (empty()) throw std::logic_error("get top from empty priority_queue");
+  return c.front();
+}
+
+template <typename T, typename Compare, size_t D>
+bool priority_queue<T, Compare, D>::empty() const {
+  return c.empty();
+}
+
+template <typename T, typename Compare, size_t D>
+size_t priority_queue<T, Compare, D>::size() const {
+  return c.size();
+}
+
+template <typename T, typename Compare, size_t D>
+void priority_queue<T, Compare, D>::reserve(size_type size) {
+  c.reserve(size);
+}
+
+template <typename T, typename Compare, size_t D>
+void priority_queue<T, Compare, D>::push(const_reference value) {
+  c.push_back(value);
+  sift_up(c.size() - 1);
+}
+
+template <typename T, typename Compare, size_t D>
+void priority_queue<T, Compare, D>::push(value_type&& value) {
+  c.push_back(std::move(value));
+  sift_up(c.size() - 1);
+}
+
+template <typename T, typename Compare, size_t D>
+template <typename... Args>
+void priority_queue<T, Compare, D>::emplace(Args&&... args) {
+  c.emplace_back(std::forward<Args>(args)...);
+  sift_up(c.size() - 1);
+}
+
+// Sifts the new elements up one by one, or rebuilds the whole heap when
+// the batch is large enough for that to be cheaper.
+template <typename T, typename Compare, size_t D>
+template <typename InputIt>
+void priority_queue<T, Compare, D>::push_range(InputIt first, InputIt last) {
+  size_type old_size = c.size();
+  for (; first != last; ++first) c.push_back(*first);
+  size_type added = c.size() - old_size;
+  if (dary_heap::rebuild_cheaper<D>(old_size, added)) {
+    rebuild();
+  } else {
+    for (size_type i = old_size; i < c.size(); ++i)
+      sift_up(i);
+  }
+}
+
+template <typename T, typename Compare, size_t D>
+void priority_queue<T, Compare, D>::pop() {
+  if (empty()) return;
+  if (c.size() > 1) {
+    c[0] = std::move(c[c.size() - 1]);
+    c.pop_back();
+    sift_down(0);
+  } else {
+    c.pop_back();
+  }
+}
+
+template <typename T, typename Compare, size_t D>
+void priority_queue<T, Compare, D>::swap(priority_queue& other) {
+  c.swap(other.c);
+  std::swap(comp, other.comp);
+}
+
+template <typename T, typename Compare, size_t D>
+void priority_queue<T, Compare, D>::clear() {
+  c.clear();
+}
+
+template <typename T, typename Compare, size_t D>
+template <typename... Args>
+void priority_queue<T, Compare, D>::insert_many(Args&&... args) {
+  (emplace(std::forward<Args>(args)), ...);
+}
+
+// Prints the heap array, which is in heap order rather than sorted.
+template <typename T, typename Compare, size_t D>
+void priority_queue<T, Compare, D>::print() {
+  for (auto it = c.begin(); it != c.end(); ++it) std::cout << *it << ' ';
+  std::cout << '\n';
+}
+
+template <typename T, typename Compare, size_t D>
+void priority_queue<T, Compare, D>::sift_up(size_type i) {
+  dary_heap::sift_up<D>(c.data(), i, comp, dary_heap::no_tracking());
+}
+
+template <typename T, typename Compare, size_t D>
+void priority_queue<T, Compare, D>::sift_down(size_type i) {
+  dary_heap::sift_down<D>(c.data(), c.size(), i, comp,
+                          dary_heap::no_tracking());
+}
+
+template <typename T, typename Compare, size_t D>
+void priority_queue<T, Compare, D>::rebuild() {
+  dary_heap::make<D>(c.data(), c.size(), comp, dary_heap::no_tracking());
+}
+
+// Priority queue whose elements can be reached after insertion: push()
+// returns a handle that stays valid until the element leaves the queue,
+// and decrease_key(), update() and erase() find it in O(1) and restore the
+// heap in O(log n). Handles of removed elements are reused.
+template <typename T, typename Compare = std::less<T>, size_t D = 4>
+class addressable_priority_queue {
+  static_assert(D >= 2, "heap arity must be at least 2");
+
+ public:
+  using value_compare = Compare;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+  using handle = size_t;
+
+  addressable_priority_queue();
+  explicit addressable_priority_queue(const Compare& comp);
+
+  const_reference top() const;
+  handle top_handle() const;
+  const_reference value(handle h) const;
+  bool contains(handle h) const;
+  bool empty() const;
+  size_type size() const;
+  void reserve(size_type size);
+
+  handle push(const_reference value);
+  handle push(value_type&& value);
+  template <typename... Args>
+  handle emplace(Args&&... args);
+  void pop();
+  void decrease_key(handle h, const_reference value);
+  void update(handle h, const_reference value);
+  void erase(handle h);
+  void clear();
+
+ private:
+  struct entry {
+    T value;
+    handle id;
+  };
+
+  struct entry_compare {
+    Compare comp;
+    bool operator()(const entry& a, const entry& b) {
+      return comp(a.value, b.value);
+    }
+  };
+
+  struct track {
+    addressable_priority_queue* q;
+    void operator()(size_t i) const { q->pos[q->entries[i].id] = i; }
+  };
+
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  vector<entry> entries;
+  vector<size_type> pos;
+  vector<handle> free_ids;
+  entry_compare comp;
+
+  handle take_id();
+  size_type checked_pos(handle h) const;
+  size_type sift_up(size_type i);
+  void sift_down(size_type i);
+  void remove_at(size_type i);
+};
+
+template <typename T, typename Compare, size_t D>
+addressable_priority_queue<T, Compare, D>::addressable_priority_queue()
+    : entries(), pos(), free_ids(), comp{Compare()} {}
+
+template <typename T, typename Compare, size_t D>
+addressable_priority_queue<T, Compare, D>::addressable_priority_queue(
+    const Compare& comp)
+    : entries(), pos(), free_ids(), comp{comp} {}
+
+template <typename T, typename Compare, size_t D>
+const T& addressable_priority_queue<T, Compare, D>::top() const {
+  if (empty()) throw std::logic_error("get top from empty priority_queue");
+  return entries.front().value;
+}
+
+template <typename T, typename Compare, size_t D>
+size_t addressable_priority_queue<T, Compare, D>::top_handle() const {
+  if (empty()) throw std::logic_error("get top from empty priority_queue");
+  return entries.front().id;
+}
+
+template <typename T, typename Compare, size_t D>
+const T& addressable_priority_queue<T, Compare, D>::value(handle h) const {
+  return entries.data()[checked_pos(h)].value;
+}
+
+template <typename T, typename Compare, size_t D>
+bool addressable_priority_queue<T, Compare, D>::contains(handle h) const {
+  return h < pos.size() && pos.data()[h] != npos;
+}
+
+template <typename T, typename Compare, size_t D>
+bool addressable_priority_queue<T, Compare, D>::empty() const {
+  return entries.empty();
+}
+
+template <typename T, typename Compare, size_t D>
+size_t addressable_priority_queue<T, Compare, D>::size() const {
+  return entries.size();
+}
+
+template <typename T, typename Compare, size_t D>
+void addressable_priority_queue<T, Compare, D>::reserve(size_type size) {
+  entries.reserve(size);
+  pos.reserve(size);
+}
+
+template <typename T, typename Compare, size_t D>
+size_t addressable_priority_queue<T, Compare, D>::push(
+    const_reference value) {
+  return emplace(value);
+}
+
+template <typename T, typename Compare, size_t D>
+size_t addressable_priority_queue<T, Compare, D>::push(value_type&& value) {
+  return emplace(std::move(value));
+}
+
+template <typename T, typename Compare, size_t D>
+template <typename... Args>
+size_t addressable_priority_queue<T, Compare, D>::emplace(Args&&... args) {
+  entries.push_back(entry{T(std::forward<Args>(args)...), npos});
+  handle id = take_id();
+  entries[entries.size() - 1].id = id;
+  sift_up(entries.size() - 1);
+  return id;
+}
+
+template <typename T, typename Compare, size_t D>
+void addressable_priority_queue<T, Compare, D>::pop() {
+  if (!empty()) remove_at(0);
+}
+
+// Raises h to a value that ranks at least as high as its current one, as
+// Dijkstra does when it finds a shorter path. Only sifts up.
+template <typename T, typename Compare, size_t D>
+void addressable_priority_queue<T, Compare, D>::decrease_key(
+    handle h, const_reference value) {
+  size_type i = checked_pos(h);
+  if (comp.comp(value, entries[i].value))
+    throw std::invalid_argument("decrease_key would lower the priority");
+  entries[i].value = value;
+  sift_up(i);
+}
+
+template <typename T, typename Compare, size_t D>
+void addressable_priority_queue<T, Compare, D>::update(handle h,
+                                                       const_reference value) {
+  size_type i = checked_pos(h);
+  entries[i].value = value;
+  sift_down(sift_up(i));
+}
+
+template <typename T, typename Compare, size_t D>
+void addressable_priority_queue<T, Compare, D>::erase(handle h) {
+  remove_at(checked_pos(h));
+}
+
+template <typename T, typename Compare, size_t D>
+void addressable_priority_queue<T, Compare, D>::clear() {
+  entries.clear();
+  pos.clear();
+  free_ids.clear();
+}
+
+template <typename T, typename Compare, size_t D>
+size_t addressable_priority_queue<T, Compare, D>::take_id() {
+  if (free_ids.empty()) {
+    pos.push_back(npos);
+    return pos.size() - 1;
+  }
+  handle id = free_ids.back();
+  free_ids.pop_back();
+  return id;
+}
+
+template <typename T, typename Compare, size_t D>
+size_t addressable_priority_queue<T, Compare, D>::checked_pos(
+    handle h) const {
+  if (!contains(h)) throw std::out_of_range("handle is not in the queue");
+  return pos.data()[h];
+}
+
+template <typename T, typename Compare, size_t D>
+size_t addressable_priority_queue<T, Compare, D>::sift_up(size_type i) {
+  return dary_heap::sift_up<D>(entries.data(), i, comp, track{this});
+}
+
+template <typename T, typename Compare, size_t D>
+void addressable_priority_queue<T, Compare, D>::sift_down(size_type i) {
+  dary_heap::sift_down<D>(entries.data(), entries.size(), i, comp,
+                          track{this});
+}
+
+// Moves the last entry into slot i and sifts it whichever way it has to go.
+template <typename T, typename Compare, size_t D>
+void addressable_priority_queue<T, Compare, D>::remove_at(size_type i) {
+  handle id = entries[i].id;
+  size_type last = entries.size() - 1;
+  if (i != last) entries[i] = std::move(entries[last]);
+  entries.pop_back();
+  pos[id] = npos;
+  free_ids.push_back(id);
+  if (i < entries.size()) {
+    sift_down(sift_up(i));
+  }
+}
+}  // namespace s21
+
+#endif
@@ -5,11 +5,19 @@
 
 #include <exception>
 #include <iostream>
+#include <stdexcept>
+#include <utility>
+
+#include "../s21_deque/s21_deque.h"
 
 namespace s21 {
-template <typename T>
+// Adaptor over a sequence with front/back/push_back/pop_front. The default
+// deque stores elements in recycled chunks, so a steady push/pop stream
+// does not allocate; s21::list can be plugged in as well.
+template <typename T, typename Container = deque<T>>
 class queue {
  public:
+  using container_type = Container;
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
@@ -24,15 +32,21 @@ class queue {
   queue& operator=(queue&& q);
   queue& operator=(const queue& q);
 
+  reference front();
   const_reference front() const;
+  reference back();
   const_reference back() const;
 
   bool empty() const;
-  size_type size();
+  size_type size() const;
   void pop();
   void push(const_reference value);
+  void push(value_type&& value);
   void swap(queue& q);
 
+  template <typename... Args>
+  reference emplace(Args&&... args);
+
   template <typename... Args>
   void insert_many_back(Args&&... args);
 
@@ -40,137 +54,114 @@ class queue {
   void print();
 
  private:
-  struct node {
-    node* next;
-    value_type data;
-    node() : next(nullptr), data(0) {}
-    node(value_type dat) : next(nullptr), data(dat) {}
-  };
-  node* head;
-  node* tail;
-  size_type sz;
+  container_type c;
 };
 
-template <typename T>
-queue<T>::queue() : head(nullptr), tail(nullptr), sz(0) {}
+template <typename T, typename Container>
+queue<T, Container>::queue() : c() {}
 
-template <typename T>
-queue<T>::queue(std::initializer_list<T> const& items) : queue() {
-  if (items.size()) {
-    for (auto el : items) push(el);
-  }
+template <typename T, typename Container>
+queue<T, Container>::queue(std::initializer_list<T> const& items) : queue() {
+  for (const T& el : items) push(el);
 }
 
-template <typename T>
-queue<T>::queue(const queue& q) : queue() {
-  for (node* temp = q.head; temp != nullptr; temp = temp->next)
-    push(temp->data);
-}
+template <typename T, typename Container>
+queue<T, Container>::queue(const queue& q) : c(q.c) {}
 
-template <typename T>
-queue<T>::queue(queue&& q) {
-  head = q.head;
-  tail = q.tail;
-  sz = q.sz;
-  q.head = nullptr;
-  q.tail = nullptr;
-  q.sz = 0;
-}
+template <typename T, typename Container>
+queue<T, Container>::queue(queue&& q) : c(std::move(q.c)) {}
 
-template <typename T>
-queue<T>::~queue() {
-  clear();
-}
+template <typename T, typename Container>
+queue<T, Container>::~queue() {}
 
-template <typename T>
-queue<T>& queue<T>::operator=(queue&& q) {
-  if (this != &q) {
-    clear();
-    queue(std::forward<T>(q));
-  }
+template <typename T, typename Container>
+queue<T, Container>& queue<T, Container>::operator=(queue&& q) {
+  if (this != &q) c = std::move(q.c);
   return *this;
 }
 
-template <typename T>
-queue<T>& queue<T>::operator=(const queue& q) {
-  if (this != &q) {
-    clear();
-    for (node* temp = q.head; temp != nullptr; temp = temp->next)
-      push(temp->data);
-  }
+template <typename T, typename Container>
+queue<T, Container>& queue<T, Container>::operator=(const queue& q) {
+  if (this != &q) c = q.c;
   return *this;
 }
 
-template <typename T>
-const T& queue<T>::front() const {
+template <typename T, typename Container>
+T& queue<T, Container>::front() {
+  if (empty()) throw std::logic_error("get front from empty Queue");
+  return c.front();
+}
+
+template <typename T, typename Container>
+const T& queue<T, Container>::front() const {
   if (empty()) throw std::logic_error("get front from empty Queue");
-  return head->data;
+  return c.front();
 }
 
-template <typename T>
-const T& queue<T>::back() const {
+template <typename T, typename Container>
+T& queue<T, Container>::back() {
   if (empty()) throw std::logic_error("get back from empty Queue");
-  return tail->data;
+  return c.back();
 }
 
-template <typename T>
-bool queue<T>::empty() const {
-  return (head == nullptr);
+template <typename T, typename Container>
+const T& queue<T, Container>::back() const {
+  if (empty()) throw std::logic_error("get back from empty Queue");
+  return c.back();
+}
+
+template <typename T, typename Container>
+bool queue<T, Container>::empty() const {
+  return c.empty();
+}
+
+template <typename T, typename Container>
+size_t queue<T, Container>::size() const {
+  return c.size();
+}
+
+template <typename T, typename Container>
+void queue<T, Container>::pop() {
+  if (!empty()) c.pop_front();
 }
 
-template <typename T>
-size_t queue<T>::size() {
-  return sz;
+template <typename T, typename Container>
+void queue<T, Container>::push(const_reference value) {
+  c.push_back(value);
 }
 
-template <typename T>
-void queue<T>::pop() {
-  if (!empty()) {
-    node* temp = head;
-    head = head->next;
-    delete temp;
-    --sz;
-  }
+template <typename T, typename Container>
+void queue<T, Container>::push(value_type&& value) {
+  c.push_back(std::move(value));
 }
 
-template <typename T>
-void queue<T>::push(const_reference value) {
-  if (empty()) {
-    tail = new node(value);
-    head = tail;
-  } else {
-    node* new_back = new node(value);
-    tail->next = new_back;
-    tail = new_back;
-  }
-  ++sz;
+template <typename T, typename Container>
+template <typename... Args>
+T& queue<T, Container>::emplace(Args&&... args) {
+  return c.emplace_back(std::forward<Args>(args)...);
 }
 
-template <typename T>
-void queue<T>::swap(queue& other) {
-  std::swap(other.sz, this->sz);
-  std::swap(other.head, this->head);
-  std::swap(other.tail, this->tail);
+template <typename T, typename Container>
+void queue<T, Container>::swap(queue& other) {
+  c.swap(other.c);
 }
 
-template <typename T>
+template <typename T, typename Container>
 template <typename... Args>
-void queue<T>::insert_many_back(Args&&... args) {
-  vector<T> tmp{args...};
-  for (size_t i = 0; i < tmp.size(); ++i) push(tmp[i]);
+void queue<T, Container>::insert_many_back(Args&&... args) {
+  (emplace(std::forward<Args>(args)), ...);
 }
 
-template <typename T>
-void queue<T>::clear() {
-  while (!empty()) pop();
+template <typename T, typename Container>
+void queue<T, Container>::clear() {
+  c.clear();
 }
 
-template <typename T>
-void queue<T>::print() {
-  for (node* temp = head; temp != nullptr; temp = temp->next)
-    std::cout << temp->data << ' ';
+template <typename T, typename Container>
+void queue<T, Container>::print() {
+  for (auto it = c.begin(); it != c.end(); ++it) std::cout << *it << ' ';
   std::cout << '\n';
 }
 }  // namespace s21
 
-#endif
\ No newline at end of file
+#endif
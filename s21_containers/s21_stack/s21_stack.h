@@ -4,11 +4,20 @@
 #include <stdbool.h>
 
 #include <iostream>
+#include <stdexcept>
+#include <utility>
+
+#include "../s21_vector/s21_vector.h"
 
 namespace s21 {
-template <typename T>
+// Adaptor over a sequence with back/push_back/pop_back; the default vector
+// keeps elements contiguous, so push and pop touch no allocator once the
+// capacity is reached. reserve() is only available when the container
+// provides it.
+template <typename T, typename Container = vector<T>>
 class stack {
  public:
+  using container_type = Container;
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
@@ -23,138 +32,119 @@ class stack {
 
   const_reference top() const;
   bool empty() const;
-  size_type size();
+  size_type size() const;
+  void reserve(size_type size);
+  size_type capacity() const;
   void push(const_reference val);
+  void push(value_type&& val);
   void pop();
   void swap(stack& other);
 
+  template <typename... Args>
+  reference emplace(Args&&... args);
+
   template <typename... Args>
   void insert_many_back(Args&&... args);
 
   void print();
 
  private:
-  struct node {
-    T data;
-    node* next;
-    node* prev;
-    node(T dat) : data(dat) {}
-  };
-  node* head;
+  container_type c;
 };
 
-template <typename T>
-stack<T>::stack() : head(nullptr) {}
+template <typename T, typename Container>
+stack<T, Container>::stack() : c() {}
 
-template <typename T>
-stack<T>::stack(std::initializer_list<T> const& item) : stack() {
-  for (T el : item) {
-    node* prev_head = head;
-    head = new node(el);
-    head->next = prev_head;
-  }
+template <typename T, typename Container>
+stack<T, Container>::stack(std::initializer_list<T> const& item) : stack() {
+  for (const T& el : item) c.push_back(el);
 }
 
-template <typename T>
-stack<T>::stack(const stack& other) : stack() {
-  if (!other.empty()) {
-    head = new node(other.head->data);
-    node* it1 = head;
-    node* it2 = other.head;
-    for (; it2->next != nullptr; it1 = it1->next, it2 = it2->next)
-      it1->next = new node(it2->next->data);
-    it1->next = nullptr;
-  }
-}
+template <typename T, typename Container>
+stack<T, Container>::stack(const stack& other) : c(other.c) {}
 
-template <typename T>
-stack<T>::stack(stack&& other) : head(other.head) {
-  other.head = nullptr;
-}
+template <typename T, typename Container>
+stack<T, Container>::stack(stack&& other) : c(std::move(other.c)) {}
 
-template <typename T>
-stack<T>::~stack() {
-  while (!empty()) pop();
-}
+template <typename T, typename Container>
+stack<T, Container>::~stack() {}
 
-template <typename T>
-stack<T>& stack<T>::operator=(stack&& other) {
-  if (this != &other) {
-    ~stack();
-    head = other.head;
-    other.head = nullptr;
-  }
+template <typename T, typename Container>
+stack<T, Container>& stack<T, Container>::operator=(stack&& other) {
+  if (this != &other) c = std::move(other.c);
   return *this;
 }
 
-template <typename T>
-const T& stack<T>::top() const {
+template <typename T, typename Container>
+const T& stack<T, Container>::top() const {
   if (empty()) {
     throw std::logic_error("get top from empty stack");
   }
-  return head->data;
+  return c.back();
 }
 
-template <typename T>
-bool stack<T>::empty() const {
-  return (head == nullptr);
+template <typename T, typename Container>
+bool stack<T, Container>::empty() const {
+  return c.empty();
 }
 
-template <typename T>
-size_t stack<T>::size() {
-  size_t res = 0;
-  if (!empty()) {
-    res = 1;
-    node* temp = head;
-    while (temp->next) {
-      ++res;
-      temp = temp->next;
-    }
-  }
-  return res;
+template <typename T, typename Container>
+size_t stack<T, Container>::size() const {
+  return c.size();
 }
 
-template <typename T>
-void stack<T>::push(const T& val) {
-  node* new_head = new node(val);
-  new_head->next = head;
-  head = new_head;
+template <typename T, typename Container>
+void stack<T, Container>::reserve(size_type size) {
+  c.reserve(size);
 }
 
-template <typename T>
-void stack<T>::pop() {
-  if (!empty()) {
-    node* temp = head;
-    head = temp->next;
-    delete temp;
-  }
+template <typename T, typename Container>
+size_t stack<T, Container>::capacity() const {
+  return c.capacity();
+}
+
+template <typename T, typename Container>
+void stack<T, Container>::push(const T& val) {
+  c.push_back(val);
+}
+
+template <typename T, typename Container>
+void stack<T, Container>::push(T&& val) {
+  c.push_back(std::move(val));
+}
+
+template <typename T, typename Container>
+template <typename... Args>
+T& stack<T, Container>::emplace(Args&&... args) {
+  return c.emplace_back(std::forward<Args>(args)...);
+}
+
+template <typename T, typename Container>
+void stack<T, Container>::pop() {
+  if (!empty()) c.pop_back();
 }
 
-template <typename T>
-void stack<T>::swap(stack& other) {
-  node* temp = head;
-  head = other.head;
-  other.head = temp;
+template <typename T, typename Container>
+void stack<T, Container>::swap(stack& other) {
+  c.swap(other.c);
 }
 
-template <typename T>
+template <typename T, typename Container>
 template <typename... Args>
-void stack<T>::insert_many_back(Args&&... args) {
-  vector<T> tmp{args...};
-  for (size_t i = 0; i < tmp.size(); ++i) push(tmp[i]);
+void stack<T, Container>::insert_many_back(Args&&... args) {
+  (emplace(std::forward<Args>(args)), ...);
 }
 
-template <typename T>
-void stack<T>::print() {
-  node* tmp = head;
+template <typename T, typename Container>
+void stack<T, Container>::print() {
   if (!empty()) {
-    while (tmp) {
-      std::cout << tmp->data << ' ';
-      tmp = tmp->next;
+    for (auto it = c.end(); it != c.begin();) {
+      --it;
+      std::cout << *it << ' ';
     }
     std::cout << '\n';
   }
 }
 }  // namespace s21
 
-#endif
\ No newline at end of file
+#endif
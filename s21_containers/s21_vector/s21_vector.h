@@ -2,13 +2,164 @@
 #define S21_VECTOR_HPP
 
 #include <stdbool.h>
+#include <sys/mman.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <iterator>
 #include <limits>
 #include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 namespace s21 {
+struct growth_x2 {
+  static size_t next(size_t cap, size_t min_cap, size_t elem_size);
+};
+
+struct growth_x1_5 {
+  static size_t next(size_t cap, size_t min_cap, size_t elem_size);
+};
+
+struct growth_size_class {
+  static size_t next(size_t cap, size_t min_cap, size_t elem_size);
+};
+
+inline size_t growth_x2::next(size_t cap, size_t min_cap, size_t) {
+  return std::max(2 * cap, min_cap);
+}
+
+inline size_t growth_x1_5::next(size_t cap, size_t min_cap, size_t) {
+  return std::max(cap + cap / 2, min_cap);
+}
+
+// Grows by x1.5 and then rounds the byte size up to the next malloc size
+// class (four classes per power of two, as in jemalloc and tcmalloc), so the
+// slack the allocator would waste becomes usable capacity instead.
+inline size_t growth_size_class::next(size_t cap, size_t min_cap,
+                                      size_t elem_size) {
+  size_t bytes = std::max(cap + cap / 2, min_cap) * elem_size;
+  size_t rounded = 16;
+  if (bytes > 128) {
+    size_t step = 16;
+    while ((step << 3) < bytes) step <<= 1;
+    rounded = (bytes + step - 1) / step * step;
+  } else {
+    rounded = (bytes + 15) / 16 * 16;
+  }
+  return std::max(rounded / elem_size, min_cap);
+}
+
+template <std::size_t Alignment = 0>
+struct aligned_memory {
+  static void* allocate(size_t bytes, size_t align);
+  static void deallocate(void* ptr, size_t bytes, size_t align);
+};
+
+template <std::size_t Alignment = 0>
+struct huge_page_memory {
+  static constexpr size_t page_size = size_t(2) << 20;
+
+  static void* allocate(size_t bytes, size_t align);
+  static void deallocate(void* ptr, size_t bytes, size_t align);
+};
+
+template <std::size_t Alignment>
+void* aligned_memory<Alignment>::allocate(size_t bytes, size_t align) {
+  align = std::max(Alignment, align);
+  if (align <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) return ::operator new(bytes);
+  return ::operator new(bytes, std::align_val_t(align));
+}
+
+template <std::size_t Alignment>
+void aligned_memory<Alignment>::deallocate(void* ptr, size_t, size_t align) {
+  align = std::max(Alignment, align);
+  if (align <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    ::operator delete(ptr);
+  else
+    ::operator delete(ptr, std::align_val_t(align));
+}
+
+// Buffers of at least one huge page are mapped directly, aligned to a 2MB
+// boundary and advised to the kernel as transparent huge page candidates.
+// Smaller buffers come from aligned_memory.
+template <std::size_t Alignment>
+void* huge_page_memory<Alignment>::allocate(size_t bytes, size_t align) {
+  if (bytes < page_size || std::max(Alignment, align) > page_size)
+    return aligned_memory<Alignment>::allocate(bytes, align);
+  size_t len = (bytes + page_size - 1) / page_size * page_size;
+  void* mem = ::mmap(nullptr, len + page_size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mem == MAP_FAILED) throw std::bad_alloc();
+  char* raw = static_cast<char*>(mem);
+  char* ptr = reinterpret_cast<char*>(
+      (reinterpret_cast<std::uintptr_t>(raw) + page_size - 1) / page_size *
+      page_size);
+  if (ptr != raw) ::munmap(raw, ptr - raw);
+  if (ptr + len != raw + len + page_size)
+    ::munmap(ptr + len, raw + len + page_size - (ptr + len));
+#if defined(MADV_HUGEPAGE)
+  ::madvise(ptr, len, MADV_HUGEPAGE);
+#endif
+  return ptr;
+}
+
+template <std::size_t Alignment>
+void huge_page_memory<Alignment>::deallocate(void* ptr, size_t bytes,
+                                             size_t align) {
+  if (bytes < page_size || std::max(Alignment, align) > page_size)
+    aligned_memory<Alignment>::deallocate(ptr, bytes, align);
+  else
+    ::munmap(ptr, (bytes + page_size - 1) / page_size * page_size);
+}
+
+// Element-wise building blocks shared by the contiguous containers. Each one
+// either finishes or destroys what it already constructed before rethrowing.
+namespace detail {
 template <typename T>
+void destroy_range(T* first, T* last) {
+  if (!std::is_trivially_destructible<T>::value)
+    for (; first != last; ++first) first->~T();
+}
+
+// Moves when T's move constructor is noexcept, copies otherwise.
+template <typename T>
+void relocate_range(T* first, T* last, T* dest) {
+  if constexpr (std::is_trivially_copyable<T>::value) {
+    if (last != first) std::memcpy(dest, first, (last - first) * sizeof(T));
+    return;
+  }
+  T* cur = dest;
+  try {
+    for (; first != last; ++first, ++cur)
+      new (cur) T(std::move_if_noexcept(*first));
+  } catch (...) {
+    destroy_range(dest, cur);
+    throw;
+  }
+}
+
+template <typename T, typename... Args>
+void construct_each(T* dest, Args&&... args) {
+  size_t i = 0;
+  try {
+    ((new (dest + i) T(std::forward<Args>(args)), ++i), ...);
+  } catch (...) {
+    destroy_range(dest, dest + i);
+    throw;
+  }
+}
+}  // namespace detail
+
+template <typename T, typename Growth = growth_x2,
+          typename Memory = aligned_memory<>>
 class vector {
  public:
   using value_type = T;
@@ -22,14 +173,14 @@ class vector {
   vector(size_type n);
   vector(std::initializer_list<value_type> const& items);
   vector(const vector& v);
-  vector(vector&& v);
+  vector(vector&& v) noexcept;
   ~vector();
-  vector& operator=(vector&& v);
+  vector& operator=(vector&& v) noexcept;
 
   reference at(size_type pos);
   reference operator[](size_type pos);
-  const_reference front();
-  const_reference back();
+  const_reference front() const;
+  const_reference back() const;
   iterator data() const;
 
   iterator begin() const;
@@ -41,13 +192,25 @@ class vector {
   void reserve(size_type size);
   size_type capacity() const;
   void shrink_to_fit();
+  size_type reallocations() const;
+  size_type bytes_moved() const;
+  size_type peak_capacity() const;
 
   void clear();
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type&& value);
+  template <typename InputIt>
+  iterator insert(iterator pos, InputIt first, InputIt last);
+  template <typename InputIt>
+  void assign(InputIt first, InputIt last);
   void erase(iterator pos);
+  iterator erase(iterator first, iterator last);
+  template <typename Pred>
+  size_type erase_if(Pred pred);
   void push_back(const_reference value);
+  void push_back(value_type&& value);
   void pop_back();
-  void swap(vector& other);
+  void swap(vector& other) noexcept;
 
   void print();
 
@@ -57,189 +220,328 @@ class vector {
   template <typename... Args>
   void insert_many_back(Args&&... args);
 
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
+
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+
+  static void set_nontemporal_threshold(size_type bytes);
+  static size_type nontemporal_threshold();
+
  private:
   size_type temp_size;
   size_type cap;
   value_type* mas;
+  size_type reallocs;
+  size_type moved;
+  size_type peak;
+
+  static value_type* allocate(size_type n);
+  static void deallocate(value_type* ptr, size_type n);
+  static void destroy(value_type* first, value_type* last);
+  static void relocate(value_type* first, value_type* last, value_type* dest);
+  static void copy_bytes(void* dest, const void* src, size_type n);
+
+  static constexpr bool trivial = std::is_trivially_copyable<T>::value;
+  static inline size_type nontemporal_bytes = 0;
+
+  bool needs_growth(size_type count) const;
+  size_type grow_capacity(size_type min_cap) const;
+  void reallocate(size_type new_cap);
+  void adopt(value_type* new_mas, size_type new_cap, size_type relocated);
+  template <typename Fill>
+  void realloc_gap(size_type pos, size_type count, Fill fill);
+  template <typename ForwardIt>
+  static void construct_range(value_type* dest, ForwardIt first,
+                              ForwardIt last);
 };
 
-template <typename T>
-vector<T>::vector() : temp_size(0), cap(0), mas(0) {}
-
-template <typename T>
-vector<T>::vector(size_t n) : temp_size(n), cap(n), mas(new T[n]) {
-  if (mas == nullptr) throw std::bad_alloc();
-  for (size_t i = 0; i < n; ++i) mas[i] = T();
+template <typename T, typename Growth, typename Memory>
+vector<T, Growth, Memory>::vector()
+    : temp_size(0), cap(0), mas(nullptr), reallocs(0), moved(0), peak(0) {}
+
+template <typename T, typename Growth, typename Memory>
+vector<T, Growth, Memory>::vector(size_t n)
+    : temp_size(0),
+      cap(n),
+      mas(allocate(n)),
+      reallocs(0),
+      moved(0),
+      peak(n) {
+  try {
+    for (; temp_size < n; ++temp_size) new (mas + temp_size) T();
+  } catch (...) {
+    destroy(mas, mas + temp_size);
+    deallocate(mas, cap);
+    throw;
+  }
 }
 
-template <typename T>
-vector<T>::vector(std::initializer_list<T> const& items)
-    : vector(items.size()) {
-  for (size_t i = 0; i < temp_size; ++i) mas[i] = *(items.begin() + i);
+template <typename T, typename Growth, typename Memory>
+vector<T, Growth, Memory>::vector(std::initializer_list<T> const& items)
+    : temp_size(0),
+      cap(items.size()),
+      mas(allocate(items.size())),
+      reallocs(0),
+      moved(0),
+      peak(items.size()) {
+  try {
+    for (; temp_size < items.size(); ++temp_size)
+      new (mas + temp_size) T(*(items.begin() + temp_size));
+  } catch (...) {
+    destroy(mas, mas + temp_size);
+    deallocate(mas, cap);
+    throw;
+  }
 }
 
-template <typename T>
-vector<T>::vector(const vector<T>& v) : vector(v.capacity()) {
-  temp_size = v.temp_size;
-  for (size_t i = 0; i < temp_size; ++i) mas[i] = v.mas[i];
+template <typename T, typename Growth, typename Memory>
+vector<T, Growth, Memory>::vector(const vector& v)
+    : temp_size(0),
+      cap(v.temp_size),
+      mas(allocate(v.temp_size)),
+      reallocs(0),
+      moved(0),
+      peak(v.temp_size) {
+  if constexpr (trivial) {
+    copy_bytes(mas, v.mas, v.temp_size * sizeof(T));
+    temp_size = v.temp_size;
+    return;
+  }
+  try {
+    for (; temp_size < v.temp_size; ++temp_size)
+      new (mas + temp_size) T(v.mas[temp_size]);
+  } catch (...) {
+    destroy(mas, mas + temp_size);
+    deallocate(mas, cap);
+    throw;
+  }
 }
 
-template <typename T>
-vector<T>::vector(vector<T>&& v) : vector() {
-  temp_size = v.temp_size;
-  v.temp_size = 0;
-  cap = v.cap;
-  v.cap = 0;
-  mas = v.mas;
-  v.mas = nullptr;
+template <typename T, typename Growth, typename Memory>
+vector<T, Growth, Memory>::vector(vector&& v) noexcept : vector() {
+  swap(v);
 }
 
-template <typename T>
-vector<T>::~vector() {
-  delete[] mas;
+template <typename T, typename Growth, typename Memory>
+vector<T, Growth, Memory>::~vector() {
+  destroy(mas, mas + temp_size);
+  deallocate(mas, cap);
   temp_size = 0;
   cap = 0;
   mas = nullptr;
 }
 
-template <typename T>
-vector<T>& vector<T>::operator=(vector&& v) {
+template <typename T, typename Growth, typename Memory>
+vector<T, Growth, Memory>& vector<T, Growth, Memory>::operator=(
+    vector&& v) noexcept {
   if (this != &v) this->swap(v);
   return *this;
 }
 
-template <typename T>
-T& vector<T>::at(size_t pos) {
+template <typename T, typename Growth, typename Memory>
+T& vector<T, Growth, Memory>::at(size_t pos) {
   if (pos >= temp_size) throw std::out_of_range("Index out range");
   return *(mas + pos);
 }
 
-template <typename T>
-T& vector<T>::operator[](size_t pos) {
+template <typename T, typename Growth, typename Memory>
+T& vector<T, Growth, Memory>::operator[](size_t pos) {
   return *(mas + pos);
 }
 
-template <typename T>
-const T& vector<T>::front() {
+template <typename T, typename Growth, typename Memory>
+const T& vector<T, Growth, Memory>::front() const {
   return *mas;
 }
 
-template <typename T>
-const T& vector<T>::back() {
+template <typename T, typename Growth, typename Memory>
+const T& vector<T, Growth, Memory>::back() const {
   return *(mas + temp_size - 1);
 }
 
-template <typename T>
-T* vector<T>::data() const {
+template <typename T, typename Growth, typename Memory>
+T* vector<T, Growth, Memory>::data() const {
   return mas;
 }
 
-template <typename T>
-T* vector<T>::begin() const {
+template <typename T, typename Growth, typename Memory>
+T* vector<T, Growth, Memory>::begin() const {
   return mas;
 }
 
-template <typename T>
-T* vector<T>::end() const {
+template <typename T, typename Growth, typename Memory>
+T* vector<T, Growth, Memory>::end() const {
   return mas + temp_size;
 }
 
-template <typename T>
-bool vector<T>::empty() const {
+template <typename T, typename Growth, typename Memory>
+bool vector<T, Growth, Memory>::empty() const {
   return (temp_size == 0);
 }
 
-template <typename T>
-size_t vector<T>::size() const {
+template <typename T, typename Growth, typename Memory>
+size_t vector<T, Growth, Memory>::size() const {
   return temp_size;
 }
 
-template <typename T>
-size_t vector<T>::max_size() const {
+template <typename T, typename Growth, typename Memory>
+size_t vector<T, Growth, Memory>::max_size() const {
   return std::numeric_limits<std::size_t>::max() / (2 * sizeof(T));
 }
 
-template <typename T>
-void vector<T>::reserve(size_t size) {
+template <typename T, typename Growth, typename Memory>
+void vector<T, Growth, Memory>::reserve(size_t size) {
   if (size > max_size())
     throw std::length_error("Can't allocate memory of this size");
-  if (size > cap) {
-    vector<T> tmp(size);
-    for (size_t i = 0; i < temp_size; ++i) tmp.mas[i] = mas[i];
-    tmp.temp_size = temp_size;
-    *this = std::move(tmp);
-  }
+  if (size > cap) reallocate(size);
   return;
 }
 
-template <typename T>
-size_t vector<T>::capacity() const {
+template <typename T, typename Growth, typename Memory>
+size_t vector<T, Growth, Memory>::capacity() const {
   return cap;
 }
 
-template <typename T>
-void vector<T>::shrink_to_fit() {
-  if ((cap > temp_size) && (temp_size > 0)) {
-    vector<T> tmp(temp_size);
-    for (size_t i = 0; i < temp_size; ++i) tmp.mas[i] = mas[i];
-    *this = std::move(tmp);
-  }
+template <typename T, typename Growth, typename Memory>
+size_t vector<T, Growth, Memory>::reallocations() const {
+  return reallocs;
+}
+
+template <typename T, typename Growth, typename Memory>
+size_t vector<T, Growth, Memory>::bytes_moved() const {
+  return moved;
+}
+
+template <typename T, typename Growth, typename Memory>
+size_t vector<T, Growth, Memory>::peak_capacity() const {
+  return peak;
+}
+
+template <typename T, typename Growth, typename Memory>
+void vector<T, Growth, Memory>::shrink_to_fit() {
+  if ((cap > temp_size) && (temp_size > 0)) reallocate(temp_size);
   return;
 }
 
-template <typename T>
-void vector<T>::clear() {
-  delete[] mas;
+template <typename T, typename Growth, typename Memory>
+void vector<T, Growth, Memory>::clear() {
+  destroy(mas, mas + temp_size);
+  deallocate(mas, cap);
   mas = nullptr;
   temp_size = 0;
   cap = 0;
   return;
 }
 
-template <typename T>
-T* vector<T>::insert(T* pos, const T& value) {
-  size_t pos_t = pos - begin();
-  ++temp_size;
-  if (temp_size + 1 > cap) {
-    vector<T> tmp(2 * ((cap > 0) ? cap : 1));
-    tmp.temp_size = temp_size;
-    for (size_t i = 0; i < temp_size - 1; ++i) tmp.mas[i] = mas[i];
-    *this = std::move(tmp);
-  }
-  for (size_t i = temp_size - 1; i > pos_t; --i) mas[i] = mas[i - 1];
-  mas[pos_t] = value;
-  return (mas + pos_t);
+template <typename T, typename Growth, typename Memory>
+T* vector<T, Growth, Memory>::insert(T* pos, const T& value) {
+  return emplace(pos, value);
 }
 
-template <typename T>
-void vector<T>::erase(T* pos) {
+template <typename T, typename Growth, typename Memory>
+T* vector<T, Growth, Memory>::insert(T* pos, T&& value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename T, typename Growth, typename Memory>
+void vector<T, Growth, Memory>::erase(T* pos) {
   size_t pos_t = pos - begin();
+  if constexpr (trivial)
+    std::memmove(mas + pos_t, mas + pos_t + 1,
+                 (temp_size - pos_t - 1) * sizeof(T));
+  else
+    std::move(mas + pos_t + 1, mas + temp_size, mas + pos_t);
   --temp_size;
-  for (size_t i = pos_t; i < temp_size; ++i) mas[i] = mas[i + 1];
+  mas[temp_size].~T();
   return;
 }
 
-template <typename T>
-void vector<T>::push_back(const T& value) {
-  ++temp_size;
-  if (temp_size + 1 > cap) {
-    vector<T> tmp(2 * ((cap > 0) ? cap : 1));
-    tmp.temp_size = temp_size;
-    for (size_t i = 0; i < temp_size - 1; ++i) tmp.mas[i] = mas[i];
-    *this = std::move(tmp);
+template <typename T, typename Growth, typename Memory>
+template <typename InputIt>
+T* vector<T, Growth, Memory>::insert(T* pos, InputIt first, InputIt last) {
+  size_t pos_t = pos - begin();
+  size_t old_size = temp_size;
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+    size_t count = std::distance(first, last);
+    if (needs_growth(count)) {
+      realloc_gap(pos_t, count,
+                  [&](T* dest) { construct_range(dest, first, last); });
+      return (mas + pos_t);
+    }
+    construct_range(mas + temp_size, first, last);
+    temp_size += count;
+  } else {
+    for (; first != last; ++first) emplace_back(*first);
   }
-  mas[temp_size - 1] = value;
+  std::rotate(mas + pos_t, mas + old_size, mas + temp_size);
+  return (mas + pos_t);
+}
+
+template <typename T, typename Growth, typename Memory>
+template <typename InputIt>
+void vector<T, Growth, Memory>::assign(InputIt first, InputIt last) {
+  destroy(mas, mas + temp_size);
+  temp_size = 0;
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+    size_t count = std::distance(first, last);
+    if (count > cap) adopt(allocate(count), count, 0);
+    construct_range(mas, first, last);
+    temp_size = count;
+  } else {
+    for (; first != last; ++first) emplace_back(*first);
+  }
+}
+
+template <typename T, typename Growth, typename Memory>
+T* vector<T, Growth, Memory>::erase(T* first, T* last) {
+  size_t pos_t = first - begin();
+  size_t count = last - first;
+  if (count > 0) {
+    if constexpr (trivial)
+      std::memmove(first, last, (end() - last) * sizeof(T));
+    else
+      std::move(last, end(), first);
+    destroy(end() - count, end());
+    temp_size -= count;
+  }
+  return (mas + pos_t);
+}
+
+template <typename T, typename Growth, typename Memory>
+template <typename Pred>
+size_t vector<T, Growth, Memory>::erase_if(Pred pred) {
+  T* new_end = std::remove_if(begin(), end(), pred);
+  size_t count = end() - new_end;
+  destroy(new_end, end());
+  temp_size -= count;
+  return count;
+}
+
+template <typename T, typename Growth, typename Memory>
+void vector<T, Growth, Memory>::push_back(const T& value) {
+  emplace_back(value);
   return;
 }
 
-template <typename T>
-void vector<T>::pop_back() {
+template <typename T, typename Growth, typename Memory>
+void vector<T, Growth, Memory>::push_back(T&& value) {
+  emplace_back(std::move(value));
+  return;
+}
+
+template <typename T, typename Growth, typename Memory>
+void vector<T, Growth, Memory>::pop_back() {
   --temp_size;
+  mas[temp_size].~T();
   return;
 }
 
-template <typename T>
-void vector<T>::swap(vector& other) {
+template <typename T, typename Growth, typename Memory>
+void vector<T, Growth, Memory>::swap(vector& other) noexcept {
   size_t tsize = temp_size;
   temp_size = other.temp_size;
   other.temp_size = tsize;
@@ -251,30 +553,223 @@ void vector<T>::swap(vector& other) {
   T* tmas = mas;
   mas = other.mas;
   other.mas = tmas;
+
+  std::swap(reallocs, other.reallocs);
+  std::swap(moved, other.moved);
+  std::swap(peak, other.peak);
   return;
 }
 
-template <typename T>
-void vector<T>::print() {
+template <typename T, typename Growth, typename Memory>
+void vector<T, Growth, Memory>::print() {
   for (size_t i = 0; i < temp_size; ++i) std::cout << mas[i] << ' ';
   std::cout << "\nsize: " << temp_size << "\ncapacity: " << cap << "\n\n";
 }
 
-template <typename T>
+template <typename T, typename Growth, typename Memory>
 template <typename... Args>
-T* vector<T>::insert_many(const T* pos, Args&&... args) {
-  vector<T> tmp{args...};
-  T* tmp_pos = (T*)pos;
-  for (size_t i = 0; i < tmp.size(); ++i) tmp_pos = insert(tmp_pos, tmp[i]) + 1;
-  return tmp_pos;
+T* vector<T, Growth, Memory>::insert_many(const T* pos, Args&&... args) {
+  size_t pos_t = pos - begin();
+  size_t count = sizeof...(Args);
+  if (needs_growth(count)) {
+    realloc_gap(pos_t, count, [&](T* dest) {
+      detail::construct_each(dest, std::forward<Args>(args)...);
+    });
+  } else {
+    detail::construct_each(mas + temp_size, std::forward<Args>(args)...);
+    temp_size += count;
+    std::rotate(mas + pos_t, mas + temp_size - count, mas + temp_size);
+  }
+  return (mas + pos_t + count);
 }
 
-template <typename T>
+template <typename T, typename Growth, typename Memory>
 template <typename... Args>
-void vector<T>::insert_many_back(Args&&... args) {
-  insert_many(this->end(), args...);
+void vector<T, Growth, Memory>::insert_many_back(Args&&... args) {
+  insert_many(this->end(), std::forward<Args>(args)...);
   return;
 }
+
+template <typename T, typename Growth, typename Memory>
+template <typename... Args>
+T* vector<T, Growth, Memory>::emplace(const T* pos, Args&&... args) {
+  size_t pos_t = pos - begin();
+  if (needs_growth(1)) {
+    realloc_gap(pos_t, 1,
+                [&](T* dest) { new (dest) T(std::forward<Args>(args)...); });
+  } else if (pos_t == temp_size) {
+    new (mas + temp_size) T(std::forward<Args>(args)...);
+    ++temp_size;
+  } else {
+    T tmp(std::forward<Args>(args)...);
+    if constexpr (trivial) {
+      std::memmove(mas + pos_t + 1, mas + pos_t,
+                   (temp_size - pos_t) * sizeof(T));
+      ++temp_size;
+    } else {
+      new (mas + temp_size) T(std::move(mas[temp_size - 1]));
+      ++temp_size;
+      std::move_backward(mas + pos_t, mas + temp_size - 2,
+                         mas + temp_size - 1);
+    }
+    mas[pos_t] = std::move(tmp);
+  }
+  return (mas + pos_t);
+}
+
+template <typename T, typename Growth, typename Memory>
+template <typename... Args>
+T& vector<T, Growth, Memory>::emplace_back(Args&&... args) {
+  if (needs_growth(1)) {
+    realloc_gap(temp_size, 1,
+                [&](T* dest) { new (dest) T(std::forward<Args>(args)...); });
+  } else {
+    new (mas + temp_size) T(std::forward<Args>(args)...);
+    ++temp_size;
+  }
+  return mas[temp_size - 1];
+}
+
+template <typename T, typename Growth, typename Memory>
+T* vector<T, Growth, Memory>::allocate(size_t n) {
+  if (n == 0) return nullptr;
+  return static_cast<T*>(Memory::allocate(n * sizeof(T), alignof(T)));
+}
+
+template <typename T, typename Growth, typename Memory>
+void vector<T, Growth, Memory>::deallocate(T* ptr, size_t n) {
+  if (ptr) Memory::deallocate(ptr, n * sizeof(T), alignof(T));
+}
+
+template <typename T, typename Growth, typename Memory>
+void vector<T, Growth, Memory>::destroy(T* first, T* last) {
+  detail::destroy_range(first, last);
+}
+
+// Trivial elements go through copy_bytes so that large relocations can use
+// streaming stores.
+template <typename T, typename Growth, typename Memory>
+void vector<T, Growth, Memory>::relocate(T* first, T* last, T* dest) {
+  if constexpr (trivial)
+    copy_bytes(dest, first, (last - first) * sizeof(T));
+  else
+    detail::relocate_range(first, last, dest);
+}
+
+template <typename T, typename Growth, typename Memory>
+void vector<T, Growth, Memory>::reallocate(size_t new_cap) {
+  T* new_mas = allocate(new_cap);
+  try {
+    relocate(mas, mas + temp_size, new_mas);
+  } catch (...) {
+    deallocate(new_mas, new_cap);
+    throw;
+  }
+  adopt(new_mas, new_cap, temp_size);
+}
+
+template <typename T, typename Growth, typename Memory>
+void vector<T, Growth, Memory>::adopt(T* new_mas, size_t new_cap,
+                                      size_t relocated) {
+  destroy(mas, mas + temp_size);
+  deallocate(mas, cap);
+  mas = new_mas;
+  cap = new_cap;
+  ++reallocs;
+  moved += relocated * sizeof(T);
+  peak = std::max(peak, new_cap);
+}
+
+template <typename T, typename Growth, typename Memory>
+void vector<T, Growth, Memory>::set_nontemporal_threshold(size_t bytes) {
+  nontemporal_bytes = bytes;
+}
+
+template <typename T, typename Growth, typename Memory>
+size_t vector<T, Growth, Memory>::nontemporal_threshold() {
+  return nontemporal_bytes;
+}
+
+// Copies of at least nontemporal_bytes (0 disables) bypass the cache with
+// streaming stores, so relocating a huge buffer does not evict the working
+// set.
+template <typename T, typename Growth, typename Memory>
+void vector<T, Growth, Memory>::copy_bytes(void* dest, const void* src,
+                                           size_t n) {
+#if defined(__SSE2__)
+  if (nontemporal_bytes > 0 && n >= nontemporal_bytes && n >= 64) {
+    char* d = static_cast<char*>(dest);
+    const char* s = static_cast<const char*>(src);
+    size_t head = (16 - reinterpret_cast<std::uintptr_t>(d) % 16) % 16;
+    std::memcpy(d, s, head);
+    d += head, s += head, n -= head;
+    for (; n >= 16; d += 16, s += 16, n -= 16)
+      _mm_stream_si128(reinterpret_cast<__m128i*>(d),
+                       _mm_loadu_si128(reinterpret_cast<const __m128i*>(s)));
+    _mm_sfence();
+    std::memcpy(d, s, n);
+    return;
+  }
+#endif
+  if (n > 0) std::memcpy(dest, src, n);
+}
+
+template <typename T, typename Growth, typename Memory>
+bool vector<T, Growth, Memory>::needs_growth(size_t count) const {
+  return (temp_size + count > cap);
+}
+
+template <typename T, typename Growth, typename Memory>
+size_t vector<T, Growth, Memory>::grow_capacity(size_t min_cap) const {
+  return std::max(Growth::next(cap, min_cap, sizeof(T)), min_cap);
+}
+
+// fill constructs count elements at the gap and cleans up after itself if it
+// throws. It runs before the old buffer dies, so it may read from this vector.
+template <typename T, typename Growth, typename Memory>
+template <typename Fill>
+void vector<T, Growth, Memory>::realloc_gap(size_t pos, size_t count,
+                                            Fill fill) {
+  size_t new_cap = grow_capacity(temp_size + count);
+  T* new_mas = allocate(new_cap);
+  bool placed = false;
+  try {
+    fill(new_mas + pos);
+    placed = true;
+    relocate(mas, mas + pos, new_mas);
+    try {
+      relocate(mas + pos, mas + temp_size, new_mas + pos + count);
+    } catch (...) {
+      destroy(new_mas, new_mas + pos);
+      throw;
+    }
+  } catch (...) {
+    if (placed) destroy(new_mas + pos, new_mas + pos + count);
+    deallocate(new_mas, new_cap);
+    throw;
+  }
+  adopt(new_mas, new_cap, temp_size);
+  temp_size += count;
+}
+
+template <typename T, typename Growth, typename Memory>
+template <typename ForwardIt>
+void vector<T, Growth, Memory>::construct_range(T* dest, ForwardIt first,
+                                                ForwardIt last) {
+  using source = std::remove_cv_t<std::remove_pointer_t<ForwardIt>>;
+  if constexpr (trivial && std::is_pointer<ForwardIt>::value &&
+                std::is_same<source, T>::value) {
+    copy_bytes(dest, first, (last - first) * sizeof(T));
+    return;
+  }
+  T* cur = dest;
+  try {
+    for (; first != last; ++first, ++cur) new (cur) T(*first);
+  } catch (...) {
+    destroy(dest, cur);
+    throw;
+  }
+}
 }  // namespace s21
 
 #endif
\ No newline at end of file
@@ -1,7 +1,20 @@
 #ifndef S21_CONTAINERSPLUS_HPP
 #define S21_CONTAINERSPLUS_HPP
 
+#include "./s21_containersplus/s21_algorithm/s21_parallel.h"
+#include "./s21_containersplus/s21_algorithm/s21_simd.h"
 #include "./s21_containersplus/s21_array/s21_array.h"
+#include "./s21_containersplus/s21_concurrent/s21_blocking_queue.h"
+#include "./s21_containersplus/s21_concurrent/s21_concurrent_stack.h"
+#include "./s21_containersplus/s21_concurrent/s21_fork_join_pool.h"
+#include "./s21_containersplus/s21_concurrent/s21_mpmc_queue.h"
+#include "./s21_containersplus/s21_concurrent/s21_spsc_queue.h"
+#include "./s21_containersplus/s21_concurrent/s21_work_stealing_deque.h"
+#include "./s21_containersplus/s21_indexed_list/s21_indexed_list.h"
+#include "./s21_containersplus/s21_intrusive_list/s21_intrusive_list.h"
+#include "./s21_containersplus/s21_mmap_vector/s21_mmap_vector.h"
 #include "./s21_containersplus/s21_multiset/s21_multiset.h"
+#include "./s21_containersplus/s21_small_vector/s21_small_vector.h"
+#include "./s21_containersplus/s21_unrolled_list/s21_unrolled_list.h"
 
 #endif
\ No newline at end of file
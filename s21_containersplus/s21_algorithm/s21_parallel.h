@@ -0,0 +1,330 @@
+#ifndef S21_PARALLEL_HPP
+#define S21_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "../../s21_containers/s21_vector/s21_vector.h"
+
+namespace s21 {
+namespace parallel {
+class thread_pool {
+ public:
+  using size_type = size_t;
+
+  explicit thread_pool(size_type threads = std::thread::hardware_concurrency());
+  thread_pool(const thread_pool&) = delete;
+  thread_pool& operator=(const thread_pool&) = delete;
+  ~thread_pool();
+
+  size_type size() const;
+
+  template <typename F>
+  void run(size_type tasks, F&& f);
+
+ private:
+  vector<std::thread> workers;
+  std::mutex mtx;
+  std::mutex run_mtx;
+  std::condition_variable wake;
+  std::condition_variable done;
+  std::function<void(size_type)> job;
+  size_type job_tasks;
+  std::atomic<size_type> next;
+  size_type active;
+  size_type generation;
+  bool stop;
+  std::exception_ptr error;
+
+  static bool& in_task();
+  void work();
+  void worker_loop();
+};
+
+inline thread_pool::thread_pool(size_type threads)
+    : job_tasks(0), next(0), active(0), generation(0), stop(false) {
+  if (threads == 0) threads = 1;
+  workers.reserve(threads - 1);
+  for (size_type i = 1; i < threads; ++i)
+    workers.emplace_back([this] { worker_loop(); });
+}
+
+inline thread_pool::~thread_pool() {
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    stop = true;
+  }
+  wake.notify_all();
+  for (auto& t : workers) t.join();
+}
+
+inline thread_pool::size_type thread_pool::size() const {
+  return workers.size() + 1;
+}
+
+inline bool& thread_pool::in_task() {
+  static thread_local bool flag = false;
+  return flag;
+}
+
+// Runs f(0) .. f(tasks - 1) on the workers and the calling thread and blocks
+// until all of them finished. Calls made from inside a task run serially, so
+// nested parallel algorithms cannot deadlock the pool.
+template <typename F>
+void thread_pool::run(size_type tasks, F&& f) {
+  if (tasks == 0) return;
+  if (tasks == 1 || workers.empty() || in_task()) {
+    for (size_type i = 0; i < tasks; ++i) f(i);
+    return;
+  }
+  std::lock_guard<std::mutex> run_lock(run_mtx);
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    job = [&f](size_type i) { f(i); };
+    job_tasks = tasks;
+    next = 0;
+    active = workers.size();
+    error = nullptr;
+    ++generation;
+  }
+  wake.notify_all();
+  work();
+  std::unique_lock<std::mutex> lock(mtx);
+  done.wait(lock, [this] { return active == 0; });
+  job = nullptr;
+  if (error) std::rethrow_exception(error);
+}
+
+inline void thread_pool::work() {
+  in_task() = true;
+  for (size_type i = next++; i < job_tasks; i = next++) {
+    try {
+      job(i);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mtx);
+      if (!error) error = std::current_exception();
+    }
+  }
+  in_task() = false;
+}
+
+inline void thread_pool::worker_loop() {
+  size_type seen = 0;
+  std::unique_lock<std::mutex> lock(mtx);
+  while (true) {
+    wake.wait(lock, [&] { return stop || generation != seen; });
+    if (stop) return;
+    seen = generation;
+    lock.unlock();
+    work();
+    lock.lock();
+    if (--active == 0) done.notify_one();
+  }
+}
+
+namespace detail {
+inline std::unique_ptr<thread_pool>& pool_slot() {
+  static std::unique_ptr<thread_pool> pool(new thread_pool());
+  return pool;
+}
+
+constexpr size_t cache_line = 64;
+constexpr size_t min_chunk_bytes = 16 * 1024;
+
+// Chunk sizes are cache line multiples, so neighbouring tasks never write to
+// the same line, and large enough to amortise the hand-off to a worker.
+template <typename T>
+size_t chunk_size(const thread_pool& pool, size_t n) {
+  size_t line = std::max<size_t>(1, cache_line / sizeof(T));
+  size_t tasks = pool.size() * 4;
+  size_t chunk = std::max(min_chunk_bytes / sizeof(T), (n + tasks - 1) / tasks);
+  return std::max(line, (chunk + line - 1) / line * line);
+}
+
+template <typename T, typename F>
+void for_chunks(thread_pool& pool, size_t n, F&& f) {
+  size_t chunk = chunk_size<T>(pool, n);
+  pool.run((n + chunk - 1) / chunk, [&](size_t i) {
+    f(i, i * chunk, std::min(n, (i + 1) * chunk));
+  });
+}
+
+// Uninitialised storage for n elements that remembers which slots hold a
+// live object, so a throwing move leaves nothing constructed or allocated
+// behind. Each slot is written by one task only, so the flags need no
+// synchronisation.
+template <typename T>
+class scratch {
+ public:
+  explicit scratch(size_t n)
+      : live(n), items(static_cast<T*>(::operator new(n * sizeof(T)))) {}
+  scratch(const scratch&) = delete;
+  scratch& operator=(const scratch&) = delete;
+  ~scratch() {
+    if (!std::is_trivially_destructible<T>::value)
+      for (size_t i = 0; i < live.size(); ++i)
+        if (live[i]) items[i].~T();
+    ::operator delete(items);
+  }
+
+  void construct(size_t i, T&& value) {
+    new (items + i) T(std::move(value));
+    live[i] = 1;
+  }
+
+  T& operator[](size_t i) { return items[i]; }
+
+  void destroy(size_t i) {
+    live[i] = 0;
+    items[i].~T();
+  }
+
+ private:
+  vector<unsigned char> live;
+  T* items;
+};
+
+template <typename T, typename Sort, typename Compare>
+void sort(T* first, T* last, Sort sort_chunk, Compare comp) {
+  thread_pool& pool = *pool_slot();
+  size_t n = last - first;
+  size_t parts = std::min(pool.size(), n / (min_chunk_bytes / sizeof(T) + 1));
+  if (parts < 2) {
+    sort_chunk(first, last, comp);
+    return;
+  }
+  vector<size_t> bounds;
+  for (size_t i = 0; i <= parts; ++i) bounds.push_back(n * i / parts);
+  pool.run(parts, [&](size_t i) {
+    sort_chunk(first + bounds[i], first + bounds[i + 1], comp);
+  });
+  for (size_t width = 1; width < parts; width *= 2) {
+    size_t pairs = (parts + 2 * width - 1) / (2 * width);
+    pool.run(pairs, [&](size_t p) {
+      size_t lo = 2 * width * p;
+      size_t mid = std::min(parts, lo + width);
+      size_t hi = std::min(parts, lo + 2 * width);
+      if (mid < hi)
+        std::inplace_merge(first + bounds[lo], first + bounds[mid],
+                           first + bounds[hi], comp);
+    });
+  }
+}
+}  // namespace detail
+
+inline thread_pool& default_pool() { return *detail::pool_slot(); }
+
+inline void set_thread_count(size_t threads) {
+  detail::pool_slot().reset(new thread_pool(threads));
+}
+
+inline size_t thread_count() { return default_pool().size(); }
+
+template <typename Container, typename Compare = std::less<>>
+void sort(Container& c, Compare comp = Compare()) {
+  using T = typename Container::value_type;
+  detail::sort(c.data(), c.data() + c.size(),
+               [](T* f, T* l, Compare& cmp) { std::sort(f, l, cmp); }, comp);
+}
+
+template <typename Container, typename Compare = std::less<>>
+void stable_sort(Container& c, Compare comp = Compare()) {
+  using T = typename Container::value_type;
+  detail::sort(c.data(), c.data() + c.size(),
+               [](T* f, T* l, Compare& cmp) { std::stable_sort(f, l, cmp); },
+               comp);
+}
+
+template <typename Container, typename Function>
+void for_each(Container& c, Function f) {
+  using T = typename Container::value_type;
+  T* data = c.data();
+  detail::for_chunks<T>(default_pool(), c.size(),
+                        [&](size_t, size_t lo, size_t hi) {
+                          std::for_each(data + lo, data + hi, f);
+                        });
+}
+
+template <typename InContainer, typename OutContainer, typename Function>
+void transform(const InContainer& in, OutContainer& out, Function f) {
+  if (in.size() != out.size())
+    throw std::out_of_range("Sizes of containers are different");
+  using T = typename OutContainer::value_type;
+  auto src = in.data();
+  T* dst = out.data();
+  detail::for_chunks<T>(default_pool(), in.size(),
+                        [&](size_t, size_t lo, size_t hi) {
+                          std::transform(src + lo, src + hi, dst + lo, f);
+                        });
+}
+
+// op must be associative: chunks are reduced independently and the partial
+// results are combined left to right.
+template <typename Container, typename T, typename BinaryOp = std::plus<>>
+T reduce(const Container& c, T init, BinaryOp op = BinaryOp()) {
+  using V = typename Container::value_type;
+  const V* data = c.data();
+  size_t n = c.size();
+  thread_pool& pool = default_pool();
+  size_t chunk = detail::chunk_size<V>(pool, n);
+  vector<T> partial;
+  partial.reserve((n + chunk - 1) / chunk);
+  for (size_t i = 0; i < n; i += chunk) partial.push_back(init);
+  detail::for_chunks<V>(pool, n, [&](size_t i, size_t lo, size_t hi) {
+    T acc = data[lo];
+    for (++lo; lo < hi; ++lo) acc = op(std::move(acc), data[lo]);
+    partial[i] = std::move(acc);
+  });
+  for (size_t i = 0; i < partial.size(); ++i)
+    init = op(std::move(init), partial[i]);
+  return init;
+}
+
+// Stable: elements keep their relative order inside both groups. Returns an
+// iterator to the first element of the second group.
+template <typename Container, typename Predicate>
+auto partition(Container& c, Predicate pred) {
+  using T = typename Container::value_type;
+  T* data = c.data();
+  size_t n = c.size();
+  thread_pool& pool = default_pool();
+  size_t chunk = detail::chunk_size<T>(pool, n);
+  size_t count = (n + chunk - 1) / chunk;
+  vector<unsigned char> flags(n);
+  vector<size_t> offsets(count + 1);
+  detail::for_chunks<T>(pool, n, [&](size_t i, size_t lo, size_t hi) {
+    size_t trues = 0;
+    for (; lo < hi; ++lo) trues += flags[lo] = pred(data[lo]) ? 1 : 0;
+    offsets[i + 1] = trues;
+  });
+  for (size_t i = 0; i < count; ++i) offsets[i + 1] += offsets[i];
+  size_t split = offsets[count];
+  detail::scratch<T> buffer(n);
+  detail::for_chunks<T>(pool, n, [&](size_t i, size_t lo, size_t hi) {
+    size_t t = offsets[i];
+    size_t f = split + lo - offsets[i];
+    for (; lo < hi; ++lo)
+      buffer.construct(flags[lo] ? t++ : f++, std::move(data[lo]));
+  });
+  detail::for_chunks<T>(pool, n, [&](size_t, size_t lo, size_t hi) {
+    for (; lo < hi; ++lo) {
+      data[lo] = std::move(buffer[lo]);
+      buffer.destroy(lo);
+    }
+  });
+  return c.begin() + split;
+}
+}  // namespace parallel
+}  // namespace s21
+
+#endif
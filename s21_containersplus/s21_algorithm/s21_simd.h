@@ -0,0 +1,381 @@
+#ifndef S21_SIMD_HPP
+#define S21_SIMD_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <type_traits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define S21_SIMD_X86 1
+#endif
+
+namespace s21 {
+namespace simd {
+enum class level { scalar, sse2, avx2, avx512 };
+
+template <typename T>
+struct is_vectorizable
+    : std::integral_constant<bool, std::is_arithmetic<T>::value &&
+                                       !std::is_same<T, bool>::value &&
+                                       !std::is_same<T, long double>::value> {
+};
+
+namespace detail {
+inline level detect_level() {
+#if defined(S21_SIMD_X86)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    return level::avx512;
+  if (__builtin_cpu_supports("avx2")) return level::avx2;
+  if (__builtin_cpu_supports("sse2")) return level::sse2;
+#endif
+  return level::scalar;
+}
+
+inline level& forced_level() {
+  static level forced = detect_level();
+  return forced;
+}
+
+#define S21_SIMD_INLINE inline __attribute__((always_inline))
+
+// Lane type that sums wrap in: signed integer lanes would overflow, which
+// is undefined, so integers are added as their unsigned counterparts.
+template <typename T, bool = std::is_integral<T>::value>
+struct wrapping {
+  typedef std::make_unsigned_t<T> type;
+};
+
+template <typename T>
+struct wrapping<T, false> {
+  typedef T type;
+};
+
+// One generic kernel per operation over W-byte GCC vector types. The
+// dispatchers below inline it into functions compiled for a given ISA, so
+// the same source becomes SSE2, AVX2 or AVX-512 code.
+template <typename T, std::size_t W>
+struct kernels {
+  typedef std::conditional_t<sizeof(T) != 0, unsigned long long, T> word;
+  typedef T vec __attribute__((vector_size(W)));
+  typedef word bits __attribute__((vector_size(W)));
+  static constexpr std::size_t lanes = W / sizeof(T);
+
+  template <typename Mask>
+  static S21_SIMD_INLINE bool any(const Mask& mask) {
+    bits b = (bits)mask;
+    word res = 0;
+    for (std::size_t i = 0; i < W / sizeof(word); ++i) res |= b[i];
+    return res != 0;
+  }
+
+  static S21_SIMD_INLINE const T* find(const T* first, const T* last,
+                                       T value) {
+    vec needle = {};
+    needle += value;
+    for (; last - first >= static_cast<long>(lanes); first += lanes) {
+      vec x;
+      std::memcpy(&x, first, W);
+      if (any(x == needle)) break;
+    }
+    for (; first != last; ++first)
+      if (*first == value) break;
+    return first;
+  }
+
+  static S21_SIMD_INLINE std::size_t count(const T* first, const T* last,
+                                           T value) {
+    vec needle = {};
+    needle += value;
+    constexpr std::size_t flush =
+        (sizeof(T) >= 4) ? (std::size_t(1) << 30)
+                         : (std::size_t(1) << (8 * sizeof(T) - 1)) - 1;
+    std::size_t total = 0;
+    while (last - first >= static_cast<long>(lanes)) {
+      decltype(needle == needle) acc = {};
+      for (std::size_t n = 0;
+           n < flush && last - first >= static_cast<long>(lanes);
+           ++n, first += lanes) {
+        vec x;
+        std::memcpy(&x, first, W);
+        acc -= (x == needle);
+      }
+      for (std::size_t i = 0; i < lanes; ++i) total += acc[i];
+    }
+    for (; first != last; ++first) total += (*first == value);
+    return total;
+  }
+
+  template <bool Min>
+  static S21_SIMD_INLINE T pick(T res, T x) {
+    return Min ? (x < res ? x : res) : (res < x ? x : res);
+  }
+
+  template <bool Min>
+  static S21_SIMD_INLINE T extreme(const T* first, const T* last) {
+    T res = *first;
+    if (last - first >= static_cast<long>(lanes)) {
+      vec acc;
+      std::memcpy(&acc, first, W);
+      first += lanes;
+      for (; last - first >= static_cast<long>(lanes); first += lanes) {
+        vec x;
+        std::memcpy(&x, first, W);
+        acc = Min ? (x < acc ? x : acc) : (acc < x ? x : acc);
+      }
+      res = acc[0];
+      for (std::size_t i = 1; i < lanes; ++i) res = pick<Min>(res, acc[i]);
+    }
+    for (; first != last; ++first) res = pick<Min>(res, *first);
+    return res;
+  }
+
+  static S21_SIMD_INLINE T sum(const T* first, const T* last, T init) {
+    typedef typename wrapping<T>::type lane;
+    typedef lane lane_vec __attribute__((vector_size(W)));
+    lane_vec acc = {};
+    for (; last - first >= static_cast<long>(lanes); first += lanes) {
+      lane_vec x;
+      std::memcpy(&x, first, W);
+      acc += x;
+    }
+    lane total = static_cast<lane>(init);
+    for (std::size_t i = 0; i < lanes; ++i) total += acc[i];
+    for (; first != last; ++first) total += static_cast<lane>(*first);
+    return static_cast<T>(total);
+  }
+
+  static S21_SIMD_INLINE void fill(T* first, T* last, T value) {
+    vec x = {};
+    x += value;
+    for (; last - first >= static_cast<long>(lanes); first += lanes)
+      std::memcpy(first, &x, W);
+    for (; first != last; ++first) *first = value;
+  }
+
+  static S21_SIMD_INLINE bool equal(const T* first1, const T* last1,
+                                    const T* first2) {
+    for (; last1 - first1 >= static_cast<long>(lanes);
+         first1 += lanes, first2 += lanes) {
+      vec x, y;
+      std::memcpy(&x, first1, W);
+      std::memcpy(&y, first2, W);
+      if (any(x != y)) return false;
+    }
+    for (; first1 != last1; ++first1, ++first2)
+      if (!(*first1 == *first2)) return false;
+    return true;
+  }
+};
+
+template <std::size_t W>
+using width = std::integral_constant<std::size_t, W>;
+
+#if defined(S21_SIMD_X86)
+template <typename F>
+__attribute__((target("sse2"))) auto run_sse2(F f) {
+  return f(width<16>());
+}
+
+template <typename F>
+__attribute__((target("avx2"))) auto run_avx2(F f) {
+  return f(width<32>());
+}
+
+template <typename F>
+__attribute__((target("avx512f,avx512bw"))) auto run_avx512(F f) {
+  return f(width<64>());
+}
+
+template <typename F, typename Scalar>
+auto dispatch(F f, Scalar scalar) {
+  switch (forced_level()) {
+    case level::avx512:
+      return run_avx512(f);
+    case level::avx2:
+      return run_avx2(f);
+    case level::sse2:
+      return run_sse2(f);
+    default:
+      return scalar();
+  }
+}
+#else
+template <typename F, typename Scalar>
+auto dispatch(F f, Scalar scalar) {
+  if (forced_level() == level::scalar) return scalar();
+  return f(width<16>());
+}
+#endif
+}  // namespace detail
+
+inline level detected_level() {
+  static const level detected = detail::detect_level();
+  return detected;
+}
+
+inline level active_level() { return detail::forced_level(); }
+
+// Caps dispatch at lvl (never above what the CPU supports); mostly useful to
+// compare kernels against each other and against the scalar loops.
+inline void set_level(level lvl) {
+  detail::forced_level() = std::min(lvl, detected_level());
+}
+
+template <typename T>
+const T* find(const T* first, const T* last, const T& value) {
+  if constexpr (is_vectorizable<T>::value) {
+    return detail::dispatch(
+        [&](auto w) __attribute__((always_inline)) {
+          return detail::kernels<T, decltype(w)::value>::find(first, last,
+                                                              value);
+        },
+        [&] { return std::find(first, last, value); });
+  } else {
+    return std::find(first, last, value);
+  }
+}
+
+template <typename T>
+std::size_t count(const T* first, const T* last, const T& value) {
+  if constexpr (is_vectorizable<T>::value) {
+    return detail::dispatch(
+        [&](auto w) __attribute__((always_inline)) {
+          return detail::kernels<T, decltype(w)::value>::count(first, last,
+                                                               value);
+        },
+        [&] {
+          return static_cast<std::size_t>(std::count(first, last, value));
+        });
+  } else {
+    return std::count(first, last, value);
+  }
+}
+
+// The kernels return the extreme value, which is then looked up with find().
+// A NaN that ends up as the lane result never compares equal to itself, so
+// such ranges fall back to the scalar search.
+template <typename T>
+const T* min_element(const T* first, const T* last) {
+  if constexpr (is_vectorizable<T>::value) {
+    if (first == last) return last;
+    T res = detail::dispatch(
+        [&](auto w) __attribute__((always_inline)) {
+          return detail::kernels<T, decltype(w)::value>::template extreme<true>(
+              first, last);
+        },
+        [&] { return *std::min_element(first, last); });
+    if (!(res == res)) return std::min_element(first, last);
+    return find(first, last, res);
+  } else {
+    return std::min_element(first, last);
+  }
+}
+
+template <typename T>
+const T* max_element(const T* first, const T* last) {
+  if constexpr (is_vectorizable<T>::value) {
+    if (first == last) return last;
+    T res = detail::dispatch(
+        [&](auto w) __attribute__((always_inline)) {
+          return detail::kernels<T, decltype(w)::value>::template extreme<
+              false>(first, last);
+        },
+        [&] { return *std::max_element(first, last); });
+    if (!(res == res)) return std::max_element(first, last);
+    return find(first, last, res);
+  } else {
+    return std::max_element(first, last);
+  }
+}
+
+// Floating point sums are reassociated across lanes, so the result may
+// differ from a sequential std::accumulate in the last bits.
+template <typename T>
+T accumulate(const T* first, const T* last, T init) {
+  if constexpr (is_vectorizable<T>::value) {
+    return detail::dispatch(
+        [&](auto w) __attribute__((always_inline)) {
+          return detail::kernels<T, decltype(w)::value>::sum(first, last,
+                                                             init);
+        },
+        [&] { return std::accumulate(first, last, init); });
+  } else {
+    return std::accumulate(first, last, init);
+  }
+}
+
+template <typename T>
+void fill(T* first, T* last, const T& value) {
+  if constexpr (is_vectorizable<T>::value) {
+    detail::dispatch(
+        [&](auto w) __attribute__((always_inline)) {
+          detail::kernels<T, decltype(w)::value>::fill(first, last, value);
+          return 0;
+        },
+        [&] {
+          std::fill(first, last, value);
+          return 0;
+        });
+  } else {
+    std::fill(first, last, value);
+  }
+}
+
+template <typename T>
+bool equal(const T* first1, const T* last1, const T* first2) {
+  if constexpr (is_vectorizable<T>::value) {
+    return detail::dispatch(
+        [&](auto w) __attribute__((always_inline)) {
+          return detail::kernels<T, decltype(w)::value>::equal(first1, last1,
+                                                               first2);
+        },
+        [&] { return std::equal(first1, last1, first2); });
+  } else {
+    return std::equal(first1, last1, first2);
+  }
+}
+
+template <typename Container>
+auto find(const Container& c, const typename Container::value_type& value) {
+  return c.begin() + (find(c.data(), c.data() + c.size(), value) - c.data());
+}
+
+template <typename Container>
+std::size_t count(const Container& c,
+                  const typename Container::value_type& value) {
+  return count(c.data(), c.data() + c.size(), value);
+}
+
+template <typename Container>
+auto min_element(const Container& c) {
+  return c.begin() + (min_element(c.data(), c.data() + c.size()) - c.data());
+}
+
+template <typename Container>
+auto max_element(const Container& c) {
+  return c.begin() + (max_element(c.data(), c.data() + c.size()) - c.data());
+}
+
+template <typename Container>
+typename Container::value_type accumulate(
+    const Container& c, typename Container::value_type init) {
+  return accumulate(c.data(), c.data() + c.size(), init);
+}
+
+template <typename Container>
+void fill(Container& c, const typename Container::value_type& value) {
+  fill(c.data(), c.data() + c.size(), value);
+}
+
+template <typename Container>
+bool equal(const Container& a, const Container& b) {
+  return a.size() == b.size() && equal(a.data(), a.data() + a.size(), b.data());
+}
+}  // namespace simd
+}  // namespace s21
+
+#undef S21_SIMD_INLINE
+
+#endif
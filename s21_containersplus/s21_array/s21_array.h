@@ -3,9 +3,11 @@
 
 #include <stdbool.h>
 
+#include <cstring>
 #include <exception>
 #include <iostream>
 #include <limits>
+#include <type_traits>
 
 namespace s21 {
 template <typename T, std::size_t N>
@@ -62,7 +64,10 @@ template <typename T, std::size_t N>
 array<T, N>::array(const array& a) {
   if (this->size() == a.size()) {
     mas = new T[N];
-    for (size_t i = 0; i < N; ++i) mas[i] = a.mas[i];
+    if constexpr (std::is_trivially_copyable<T>::value)
+      std::memcpy(mas, a.mas, N * sizeof(T));
+    else
+      for (size_t i = 0; i < N; ++i) mas[i] = a.mas[i];
   } else
     throw std::out_of_range("Sizes of arrays are different");
 }
@@ -0,0 +1,288 @@
+#ifndef S21_BLOCKING_QUEUE_HPP
+#define S21_BLOCKING_QUEUE_HPP
+
+#include <stdbool.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <utility>
+
+#include "../../s21_containers/s21_queue/s21_queue.h"
+
+namespace s21 {
+// s21::queue behind a mutex, for threads that hand work to each other and
+// sleep while there is none. Consumers block in pop_wait() until an element
+// arrives or the queue is closed; with a non-zero capacity producers block
+// in push() while the queue is full. Each side counts its sleepers and the
+// wake-ups already sent to them, so a push notifies only when a sleeping
+// consumer has not been signalled yet; a woken thread re-checks its
+// condition under the lock, which absorbs spurious wakeups.
+template <typename T>
+class blocking_queue {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  explicit blocking_queue(size_type capacity = 0);
+  blocking_queue(const blocking_queue& q) = delete;
+  blocking_queue& operator=(const blocking_queue& q) = delete;
+  ~blocking_queue();
+
+  bool push(const_reference value);
+  bool push(value_type&& value);
+  template <typename... Args>
+  bool emplace(Args&&... args);
+  bool try_push(const_reference value);
+  bool try_push(value_type&& value);
+
+  bool pop_wait(reference out);
+  template <typename Rep, typename Period>
+  bool pop_wait_for(reference out,
+                    const std::chrono::duration<Rep, Period>& timeout);
+  bool try_pop(reference out);
+  template <typename OutputIt>
+  size_type pop_bulk(OutputIt out, size_type max);
+
+  void close();
+  bool closed() const;
+  bool empty() const;
+  size_type size() const;
+  size_type capacity() const;
+
+ private:
+  using clock = std::chrono::steady_clock;
+
+  struct sleepers {
+    std::condition_variable cv;
+    size_type waiting = 0;
+    size_type signalled = 0;
+  };
+
+  mutable std::mutex mtx;
+  sleepers consumers;
+  sleepers producers;
+  queue<T> q;
+  size_type cap;
+  bool is_closed;
+
+  bool full() const;
+  static bool sleep(sleepers& s, std::unique_lock<std::mutex>& lock,
+                    const clock::time_point* deadline = nullptr);
+  static size_type claim(sleepers& s, size_type count);
+  static void wake(sleepers& s, size_type count);
+  bool wait_not_empty(std::unique_lock<std::mutex>& lock,
+                      const clock::time_point* deadline = nullptr);
+  template <typename... Args>
+  bool emplace_locked(std::unique_lock<std::mutex>& lock, Args&&... args);
+  void take_front(reference out, std::unique_lock<std::mutex>& lock);
+};
+
+template <typename T>
+blocking_queue<T>::blocking_queue(size_type capacity)
+    : q(), cap(capacity), is_closed(false) {}
+
+template <typename T>
+blocking_queue<T>::~blocking_queue() {}
+
+template <typename T>
+bool blocking_queue<T>::push(const_reference value) {
+  return emplace(value);
+}
+
+template <typename T>
+bool blocking_queue<T>::push(value_type&& value) {
+  return emplace(std::move(value));
+}
+
+// Blocks while the queue is full. Returns false, leaving the arguments
+// untouched, if the queue is or becomes closed.
+template <typename T>
+template <typename... Args>
+bool blocking_queue<T>::emplace(Args&&... args) {
+  std::unique_lock<std::mutex> lock(mtx);
+  while (full() && !is_closed) sleep(producers, lock);
+  return emplace_locked(lock, std::forward<Args>(args)...);
+}
+
+template <typename T>
+bool blocking_queue<T>::try_push(const_reference value) {
+  std::unique_lock<std::mutex> lock(mtx);
+  if (full()) return false;
+  return emplace_locked(lock, value);
+}
+
+template <typename T>
+bool blocking_queue<T>::try_push(value_type&& value) {
+  std::unique_lock<std::mutex> lock(mtx);
+  if (full()) return false;
+  return emplace_locked(lock, std::move(value));
+}
+
+// Returns false only once the queue is closed and drained.
+template <typename T>
+bool blocking_queue<T>::pop_wait(reference out) {
+  std::unique_lock<std::mutex> lock(mtx);
+  if (!wait_not_empty(lock)) return false;
+  take_front(out, lock);
+  return true;
+}
+
+template <typename T>
+template <typename Rep, typename Period>
+bool blocking_queue<T>::pop_wait_for(
+    reference out, const std::chrono::duration<Rep, Period>& timeout) {
+  clock::time_point deadline =
+      clock::now() + std::chrono::ceil<clock::duration>(timeout);
+  std::unique_lock<std::mutex> lock(mtx);
+  if (!wait_not_empty(lock, &deadline)) return false;
+  take_front(out, lock);
+  return true;
+}
+
+template <typename T>
+bool blocking_queue<T>::try_pop(reference out) {
+  std::unique_lock<std::mutex> lock(mtx);
+  if (q.empty()) return false;
+  take_front(out, lock);
+  return true;
+}
+
+// Waits like pop_wait(), then moves up to max elements to out while holding
+// the lock once. Returns 0 only once the queue is closed and drained. If
+// writing to out throws, the element being moved stays queued, and the
+// producers owed the room already freed are still woken before rethrowing.
+template <typename T>
+template <typename OutputIt>
+size_t blocking_queue<T>::pop_bulk(OutputIt out, size_type max) {
+  if (max == 0) return 0;
+  std::unique_lock<std::mutex> lock(mtx);
+  if (!wait_not_empty(lock)) return 0;
+  size_type taken = 0;
+  std::exception_ptr error;
+  try {
+    for (; taken < max && !q.empty(); ++taken, ++out) {
+      *out = std::move(q.front());
+      q.pop();
+    }
+  } catch (...) {
+    error = std::current_exception();
+  }
+  size_type woken = claim(producers, taken);
+  lock.unlock();
+  wake(producers, woken);
+  if (error) std::rethrow_exception(error);
+  return taken;
+}
+
+// Wakes every waiter. Later pushes fail; consumers still get what is queued.
+template <typename T>
+void blocking_queue<T>::close() {
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    is_closed = true;
+  }
+  consumers.cv.notify_all();
+  producers.cv.notify_all();
+}
+
+template <typename T>
+bool blocking_queue<T>::closed() const {
+  std::lock_guard<std::mutex> lock(mtx);
+  return is_closed;
+}
+
+template <typename T>
+bool blocking_queue<T>::empty() const {
+  std::lock_guard<std::mutex> lock(mtx);
+  return q.empty();
+}
+
+template <typename T>
+size_t blocking_queue<T>::size() const {
+  std::lock_guard<std::mutex> lock(mtx);
+  return q.size();
+}
+
+template <typename T>
+size_t blocking_queue<T>::capacity() const {
+  return cap;
+}
+
+template <typename T>
+bool blocking_queue<T>::full() const {
+  return cap != 0 && q.size() >= cap;
+}
+
+// One round of sleeping; the caller loops on its condition. Whatever woke
+// the thread, it leaves the sleeper count and uses up one pending signal,
+// so a signal is never counted for a thread that is no longer asleep.
+template <typename T>
+bool blocking_queue<T>::sleep(sleepers& s, std::unique_lock<std::mutex>& lock,
+                              const clock::time_point* deadline) {
+  ++s.waiting;
+  bool in_time = true;
+  if (deadline)
+    in_time = s.cv.wait_until(lock, *deadline) == std::cv_status::no_timeout;
+  else
+    s.cv.wait(lock);
+  --s.waiting;
+  if (s.signalled > 0) --s.signalled;
+  return in_time;
+}
+
+// Called under the lock: how many of count wake-ups actually need sending.
+template <typename T>
+size_t blocking_queue<T>::claim(sleepers& s, size_type count) {
+  size_type idle = s.waiting - s.signalled;
+  if (count > idle) count = idle;
+  s.signalled += count;
+  return count;
+}
+
+// Called after unlocking, so the woken thread does not block on mtx.
+template <typename T>
+void blocking_queue<T>::wake(sleepers& s, size_type count) {
+  if (count == 1)
+    s.cv.notify_one();
+  else if (count > 1)
+    s.cv.notify_all();
+}
+
+// Returns false if the queue is closed and drained, or the deadline passed
+// with nothing to take.
+template <typename T>
+bool blocking_queue<T>::wait_not_empty(std::unique_lock<std::mutex>& lock,
+                                       const clock::time_point* deadline) {
+  while (q.empty() && !is_closed)
+    if (!sleep(consumers, lock, deadline)) break;
+  return !q.empty();
+}
+
+template <typename T>
+template <typename... Args>
+bool blocking_queue<T>::emplace_locked(std::unique_lock<std::mutex>& lock,
+                                       Args&&... args) {
+  if (is_closed) return false;
+  q.emplace(std::forward<Args>(args)...);
+  size_type woken = claim(consumers, 1);
+  lock.unlock();
+  wake(consumers, woken);
+  return true;
+}
+
+template <typename T>
+void blocking_queue<T>::take_front(reference out,
+                                   std::unique_lock<std::mutex>& lock) {
+  out = std::move(q.front());
+  q.pop();
+  size_type woken = claim(producers, 1);
+  lock.unlock();
+  wake(producers, woken);
+}
+}  // namespace s21
+
+#endif
@@ -0,0 +1,217 @@
+#ifndef S21_CONCURRENT_STACK_HPP
+#define S21_CONCURRENT_STACK_HPP
+
+#include <stdbool.h>
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+#include "s21_hazard_pointer.h"
+#include "s21_sync.h"
+
+namespace s21 {
+// Lock-free stack (Treiber) for any number of threads. The head word packs
+// the top node's address with a 16-bit version that every successful CAS
+// bumps, so a head that was popped and pushed back in between never passes
+// for unchanged. Popped nodes are freed through hazard pointers, since a
+// thread racing on the same head may still be reading the node's next
+// link. When the CAS on head fails, a push and a pop try to meet in a
+// small elimination array and hand the node over without touching head.
+template <typename T>
+class concurrent_stack {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  concurrent_stack();
+  concurrent_stack(const concurrent_stack& s) = delete;
+  concurrent_stack& operator=(const concurrent_stack& s) = delete;
+  ~concurrent_stack();
+
+  void push(const_reference value);
+  void push(value_type&& value);
+  template <typename... Args>
+  void emplace(Args&&... args);
+  bool try_pop(reference out);
+
+  bool empty() const;
+
+ private:
+  struct node {
+    T value;
+    node* next;
+
+    template <typename... Args>
+    explicit node(Args&&... args)
+        : value(std::forward<Args>(args)...), next(nullptr) {}
+  };
+
+  struct alignas(sync::cache_line) exchanger {
+    std::atomic<node*> slot{nullptr};
+  };
+
+  static_assert(sizeof(void*) == 8, "tagged head needs 64-bit pointers");
+  static constexpr unsigned tag_shift = 48;
+  static constexpr uint64_t ptr_mask = (uint64_t(1) << tag_shift) - 1;
+  static constexpr size_type elimination_size = 8;
+  static constexpr unsigned elimination_wait = 128;
+
+  alignas(sync::cache_line) std::atomic<uint64_t> head;
+  exchanger elimination[elimination_size];
+
+  static node* ptr(uint64_t word);
+  static uint64_t bump(uint64_t word, node* p);
+  static void destroy(void* p);
+  static exchanger& pick(exchanger* slots);
+
+  void link(node* n);
+  bool eliminate_push(node* n);
+  node* eliminate_pop();
+};
+
+template <typename T>
+concurrent_stack<T>::concurrent_stack() : head(0) {}
+
+template <typename T>
+concurrent_stack<T>::~concurrent_stack() {
+  for (node* n = ptr(head.load()); n;) {
+    node* next = n->next;
+    delete n;
+    n = next;
+  }
+}
+
+template <typename T>
+void concurrent_stack<T>::push(const_reference value) {
+  link(new node(value));
+}
+
+template <typename T>
+void concurrent_stack<T>::push(value_type&& value) {
+  link(new node(std::move(value)));
+}
+
+template <typename T>
+template <typename... Args>
+void concurrent_stack<T>::emplace(Args&&... args) {
+  link(new node(std::forward<Args>(args)...));
+}
+
+template <typename T>
+bool concurrent_stack<T>::try_pop(reference out) {
+  sync::hazard_pointer& hp = sync::hazard_pointer::local();
+  uint64_t word = head.load(std::memory_order_seq_cst);
+  node* top;
+  for (;;) {
+    top = ptr(word);
+    if (!top) {
+      hp.clear();
+      return false;
+    }
+    hp.protect(top);
+    uint64_t again = head.load(std::memory_order_seq_cst);
+    if (again != word) {
+      word = again;
+      continue;
+    }
+    if (head.compare_exchange_weak(word, bump(word, top->next),
+                                   std::memory_order_seq_cst))
+      break;
+    if (node* n = eliminate_pop()) {
+      hp.clear();
+      out = std::move(n->value);
+      delete n;
+      return true;
+    }
+    word = head.load(std::memory_order_seq_cst);
+  }
+  hp.clear();
+  out = std::move(top->value);
+  hp.retire(top, &destroy);
+  return true;
+}
+
+// Approximate under concurrent pushes and pops.
+template <typename T>
+bool concurrent_stack<T>::empty() const {
+  return ptr(head.load(std::memory_order_acquire)) == nullptr;
+}
+
+template <typename T>
+typename concurrent_stack<T>::node* concurrent_stack<T>::ptr(uint64_t word) {
+  return reinterpret_cast<node*>(static_cast<uintptr_t>(word & ptr_mask));
+}
+
+template <typename T>
+uint64_t concurrent_stack<T>::bump(uint64_t word, node* p) {
+  uint64_t tag = (word >> tag_shift) + 1;
+  return (tag << tag_shift) | reinterpret_cast<uintptr_t>(p);
+}
+
+template <typename T>
+void concurrent_stack<T>::destroy(void* p) {
+  delete static_cast<node*>(p);
+}
+
+// Threads start at different slots so that concurrent pairs spread out.
+template <typename T>
+typename concurrent_stack<T>::exchanger& concurrent_stack<T>::pick(
+    exchanger* slots) {
+  static thread_local uint32_t seed =
+      static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&seed) >> 4) | 1;
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return slots[seed % elimination_size];
+}
+
+template <typename T>
+void concurrent_stack<T>::link(node* n) {
+  uint64_t word = head.load(std::memory_order_relaxed);
+  for (;;) {
+    n->next = ptr(word);
+    if (head.compare_exchange_weak(word, bump(word, n),
+                                   std::memory_order_seq_cst,
+                                   std::memory_order_relaxed))
+      return;
+    if (eliminate_push(n)) return;
+    word = head.load(std::memory_order_relaxed);
+  }
+}
+
+// Parks n in an exchanger for a short while. Whoever clears the slot owns
+// the node: a popper that takes it, or this thread taking it back.
+template <typename T>
+bool concurrent_stack<T>::eliminate_push(node* n) {
+  exchanger& e = pick(elimination);
+  node* expected = nullptr;
+  if (!e.slot.compare_exchange_strong(expected, n, std::memory_order_release,
+                                      std::memory_order_relaxed))
+    return false;
+  for (unsigned i = 0; i < elimination_wait; ++i) {
+    if (e.slot.load(std::memory_order_relaxed) != n) return true;
+    sync::cpu_relax();
+  }
+  expected = n;
+  return !e.slot.compare_exchange_strong(expected, nullptr,
+                                         std::memory_order_acquire);
+}
+
+// A node taken from an exchanger was never reachable from head, so nobody
+// else can hold a reference to it and it is freed without retiring.
+template <typename T>
+typename concurrent_stack<T>::node* concurrent_stack<T>::eliminate_pop() {
+  exchanger& e = pick(elimination);
+  node* n = e.slot.load(std::memory_order_relaxed);
+  if (n && e.slot.compare_exchange_strong(n, nullptr,
+                                          std::memory_order_acquire,
+                                          std::memory_order_relaxed))
+    return n;
+  return nullptr;
+}
+}  // namespace s21
+
+#endif
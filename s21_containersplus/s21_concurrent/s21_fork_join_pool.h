@@ -0,0 +1,281 @@
+#ifndef S21_FORK_JOIN_POOL_HPP
+#define S21_FORK_JOIN_POOL_HPP
+
+#include <stdbool.h>
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "../../s21_containers/s21_queue/s21_queue.h"
+#include "../../s21_containers/s21_vector/s21_vector.h"
+#include "s21_sync.h"
+#include "s21_work_stealing_deque.h"
+
+namespace s21 {
+// Fork/join scheduler for recursive divide-and-conquer work. Every worker
+// owns a work_stealing_deque: invoke(f, g) pushes g to the bottom of the
+// calling worker's deque and runs f itself; afterwards it pops g back and
+// runs it too, unless an idle worker stole it from the top in the meantime.
+// While a stolen task is still running, the joining worker steals other
+// tasks instead of blocking. Idle workers pick victims at random and sleep
+// on an event_count once there is nothing left to steal.
+//
+//   int fib(s21::fork_join_pool& pool, int n) {
+//     if (n < 2) return n;
+//     int a, b;
+//     pool.invoke([&] { a = fib(pool, n - 1); },
+//                 [&] { b = fib(pool, n - 2); });
+//     return a + b;
+//   }
+class fork_join_pool {
+ public:
+  using size_type = size_t;
+
+  explicit fork_join_pool(
+      size_type threads = std::thread::hardware_concurrency());
+  fork_join_pool(const fork_join_pool&) = delete;
+  fork_join_pool& operator=(const fork_join_pool&) = delete;
+  ~fork_join_pool();
+
+  size_type size() const;
+
+  template <typename F>
+  void run(F&& f);
+  template <typename F, typename G>
+  void invoke(F&& f, G&& g);
+
+ private:
+  // Lives in the frame of the thread that forked it, which does not return
+  // before the task is done.
+  struct task {
+    void (*call)(task*);
+    std::atomic<uint32_t> done;
+    bool external;
+    std::exception_ptr error;
+
+    explicit task(void (*call)(task*), bool external = false)
+        : call(call), done(0), external(external), error() {}
+  };
+
+  template <typename F>
+  struct bound_task : task {
+    F& f;
+
+    bound_task(F& f, bool external = false)
+        : task(&bound_task::call_f, external), f(f) {}
+
+    static void call_f(task* t) { static_cast<bound_task*>(t)->f(); }
+  };
+
+  struct worker {
+    fork_join_pool* pool;
+    uint32_t seed;
+    work_stealing_deque<task*> tasks;
+    std::thread thread;
+
+    worker(fork_join_pool* pool, uint32_t seed)
+        : pool(pool), seed(seed), tasks(), thread() {}
+  };
+
+  vector<std::unique_ptr<worker>> workers;
+  std::mutex inbox_mtx;
+  queue<task*> inbox;
+  std::atomic<size_type> inbox_size;
+  sync::event_count idle;
+  sync::event_count finished;
+  std::atomic<bool> stop;
+
+  static worker*& current();
+  void execute(task* t);
+  void worker_loop(worker* self);
+  task* find_task(worker* self);
+  task* steal(worker* self);
+  task* take_inbox();
+  bool has_work() const;
+  void join(worker* self, task& t);
+};
+
+inline fork_join_pool::fork_join_pool(size_type threads)
+    : inbox_size(0), stop(false) {
+  if (threads == 0) threads = 1;
+  workers.reserve(threads);
+  for (size_type i = 0; i < threads; ++i) {
+    workers.push_back(std::unique_ptr<worker>(
+        new worker(this, static_cast<uint32_t>(2 * i + 1))));
+  }
+  for (size_type i = 0; i < threads; ++i) {
+    worker* w = workers[i].get();
+    w->thread = std::thread([this, w] { worker_loop(w); });
+  }
+}
+
+inline fork_join_pool::~fork_join_pool() {
+  stop.store(true);
+  idle.notify_all();
+  for (size_type i = 0; i < workers.size(); ++i) workers[i]->thread.join();
+}
+
+inline fork_join_pool::size_type fork_join_pool::size() const {
+  return workers.size();
+}
+
+// Runs f on a worker and blocks until it and everything it forked are
+// done; exceptions are rethrown here. Called from a worker of this pool, it
+// just runs f. The caller sleeps on the pool's event_count rather than on
+// the task, which is gone as soon as the caller wakes.
+template <typename F>
+void fork_join_pool::run(F&& f) {
+  worker* self = current();
+  if (self && self->pool == this) {
+    f();
+    return;
+  }
+  bound_task<F> t(f, true);
+  {
+    std::lock_guard<std::mutex> lock(inbox_mtx);
+    inbox.push(&t);
+    inbox_size.fetch_add(1, std::memory_order_release);
+  }
+  idle.notify_one();
+  while (t.done.load(std::memory_order_acquire) == 0) {
+    uint32_t key = finished.prepare_wait();
+    if (t.done.load(std::memory_order_acquire) != 0) {
+      finished.cancel_wait();
+      break;
+    }
+    finished.wait(key);
+  }
+  if (t.error) std::rethrow_exception(t.error);
+}
+
+// Runs f and g, possibly in parallel, and returns when both are done. If
+// either throws, the other is still joined before the first exception is
+// rethrown.
+template <typename F, typename G>
+void fork_join_pool::invoke(F&& f, G&& g) {
+  worker* self = current();
+  if (!self || self->pool != this) {
+    run([&] { invoke(f, g); });
+    return;
+  }
+  bound_task<G> forked(g);
+  self->tasks.push(&forked);
+  // A wake-up lost to this unordered check only costs parallelism: join()
+  // runs forked itself unless someone stole it.
+  if (idle.maybe_waiting()) idle.notify_one();
+  std::exception_ptr error;
+  try {
+    f();
+  } catch (...) {
+    error = std::current_exception();
+  }
+  join(self, forked);
+  if (!error) error = forked.error;
+  if (error) std::rethrow_exception(error);
+}
+
+inline fork_join_pool::worker*& fork_join_pool::current() {
+  static thread_local worker* self = nullptr;
+  return self;
+}
+
+inline void fork_join_pool::execute(task* t) {
+  try {
+    t->call(t);
+  } catch (...) {
+    t->error = std::current_exception();
+  }
+  bool external = t->external;
+  t->done.store(1, std::memory_order_release);
+  if (external) finished.notify_all();
+}
+
+inline void fork_join_pool::worker_loop(worker* self) {
+  current() = self;
+  sync::backoff spin;
+  while (!stop.load(std::memory_order_acquire)) {
+    if (task* t = find_task(self)) {
+      execute(t);
+      spin.reset();
+    } else if (spin.spinning()) {
+      spin.pause();
+    } else {
+      uint32_t key = idle.prepare_wait();
+      if (has_work() || stop.load(std::memory_order_acquire)) {
+        idle.cancel_wait();
+      } else {
+        idle.wait(key);
+      }
+      spin.reset();
+    }
+  }
+  current() = nullptr;
+}
+
+inline fork_join_pool::task* fork_join_pool::find_task(worker* self) {
+  task* t = nullptr;
+  if (self->tasks.pop(t)) return t;
+  if ((t = steal(self))) return t;
+  return take_inbox();
+}
+
+// One pass over the other workers, starting at a random one.
+inline fork_join_pool::task* fork_join_pool::steal(worker* self) {
+  size_type n = workers.size();
+  if (n < 2) return nullptr;
+  self->seed ^= self->seed << 13;
+  self->seed ^= self->seed >> 17;
+  self->seed ^= self->seed << 5;
+  size_type start = self->seed % n;
+  task* t = nullptr;
+  for (size_type i = 0; i < n; ++i) {
+    worker* victim = workers[(start + i) % n].get();
+    if (victim != self && victim->tasks.steal(t)) return t;
+  }
+  return nullptr;
+}
+
+inline fork_join_pool::task* fork_join_pool::take_inbox() {
+  if (inbox_size.load(std::memory_order_acquire) == 0) return nullptr;
+  std::lock_guard<std::mutex> lock(inbox_mtx);
+  if (inbox.empty()) return nullptr;
+  task* t = inbox.front();
+  inbox.pop();
+  inbox_size.fetch_sub(1, std::memory_order_relaxed);
+  return t;
+}
+
+inline bool fork_join_pool::has_work() const {
+  if (inbox_size.load(std::memory_order_seq_cst) > 0) return true;
+  for (size_type i = 0; i < workers.size(); ++i)
+    if (!workers.data()[i]->tasks.empty()) return true;
+  return false;
+}
+
+// Joining never blocks: the forked task is either still at the bottom of
+// this worker's deque, where everything f pushed has already been popped
+// again, or a thief runs it and this worker helps with other tasks.
+inline void fork_join_pool::join(worker* self, task& t) {
+  task* top = nullptr;
+  if (self->tasks.pop(top)) {
+    execute(top);
+    return;
+  }
+  sync::backoff spin;
+  while (t.done.load(std::memory_order_acquire) == 0) {
+    if (task* other = steal(self)) {
+      execute(other);
+      spin.reset();
+    } else {
+      spin.pause();
+    }
+  }
+}
+}  // namespace s21
+
+#endif
@@ -0,0 +1,167 @@
+#ifndef S21_HAZARD_POINTER_HPP
+#define S21_HAZARD_POINTER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+#include "../../s21_containers/s21_vector/s21_vector.h"
+
+namespace s21 {
+namespace sync {
+// Hazard pointers (Michael, 2004). A thread publishes the node it is about
+// to dereference in its hazard slot and re-checks that the node is still
+// reachable; a node unlinked from a structure is retire()d instead of
+// deleted and freed only once no slot holds it. Every thread owns one slot,
+// taken on first use and handed back when the thread exits.
+class hazard_pointer {
+ public:
+  using deleter_type = void (*)(void*);
+
+  hazard_pointer(const hazard_pointer&) = delete;
+  hazard_pointer& operator=(const hazard_pointer&) = delete;
+  ~hazard_pointer();
+
+  static hazard_pointer& local();
+
+  void protect(const void* ptr);
+  void clear();
+  void retire(void* ptr, deleter_type deleter);
+
+ private:
+  struct record {
+    std::atomic<const void*> ptr;
+    std::atomic<bool> active;
+    record* next;
+  };
+
+  struct retired {
+    void* ptr;
+    deleter_type deleter;
+  };
+
+  struct domain {
+    std::atomic<record*> records;
+    std::atomic<size_t> count;
+    std::mutex orphans_mtx;
+    vector<retired> orphans;
+
+    domain() : records(nullptr), count(0) {}
+    ~domain();
+  };
+
+  static constexpr size_t scan_threshold = 32;
+
+  record* rec;
+  vector<retired> pending;
+
+  hazard_pointer();
+  static domain& global();
+  void scan();
+};
+
+inline hazard_pointer::hazard_pointer() : rec(nullptr) {
+  domain& d = global();
+  for (record* r = d.records.load(std::memory_order_acquire); r; r = r->next) {
+    bool expected = false;
+    if (!r->active.load(std::memory_order_relaxed) &&
+        r->active.compare_exchange_strong(expected, true)) {
+      rec = r;
+      return;
+    }
+  }
+  rec = new record;
+  rec->ptr.store(nullptr, std::memory_order_relaxed);
+  rec->active.store(true, std::memory_order_relaxed);
+  rec->next = d.records.load(std::memory_order_relaxed);
+  while (!d.records.compare_exchange_weak(rec->next, rec,
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed)) {
+  }
+  d.count.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Whatever is still protected by another thread is left to the domain and
+// adopted by the next scan of any thread.
+inline hazard_pointer::~hazard_pointer() {
+  clear();
+  scan();
+  if (!pending.empty()) {
+    domain& d = global();
+    std::lock_guard<std::mutex> lock(d.orphans_mtx);
+    for (size_t i = 0; i < pending.size(); ++i)
+      d.orphans.push_back(pending[i]);
+  }
+  rec->active.store(false, std::memory_order_release);
+}
+
+inline hazard_pointer::domain::~domain() {
+  for (size_t i = 0; i < orphans.size(); ++i)
+    orphans[i].deleter(orphans[i].ptr);
+  for (record* r = records.load(); r;) {
+    record* next = r->next;
+    delete r;
+    r = next;
+  }
+}
+
+inline hazard_pointer& hazard_pointer::local() {
+  static thread_local hazard_pointer hp;
+  return hp;
+}
+
+inline hazard_pointer::domain& hazard_pointer::global() {
+  static domain d;
+  return d;
+}
+
+// The caller must re-read the source after this and retry if ptr is no
+// longer there: only then is ptr known to have been live when published.
+// The structure has to unlink nodes with seq_cst operations as well, so
+// that either its unlink or this store comes first in the total order.
+inline void hazard_pointer::protect(const void* ptr) {
+  rec->ptr.store(ptr, std::memory_order_seq_cst);
+}
+
+inline void hazard_pointer::clear() {
+  rec->ptr.store(nullptr, std::memory_order_release);
+}
+
+inline void hazard_pointer::retire(void* ptr, deleter_type deleter) {
+  pending.push_back({ptr, deleter});
+  if (pending.size() >=
+      scan_threshold + 2 * global().count.load(std::memory_order_relaxed))
+    scan();
+}
+
+// Frees every pending node that no slot holds. The threshold grows with
+// the number of slots, so each scan frees at least half of what it looks
+// at and retire() stays amortised O(1).
+inline void hazard_pointer::scan() {
+  domain& d = global();
+  {
+    std::unique_lock<std::mutex> lock(d.orphans_mtx, std::try_to_lock);
+    if (lock.owns_lock() && !d.orphans.empty()) {
+      for (size_t i = 0; i < d.orphans.size(); ++i)
+        pending.push_back(d.orphans[i]);
+      d.orphans.clear();
+    }
+  }
+  vector<const void*> hazards;
+  for (record* r = d.records.load(std::memory_order_acquire); r; r = r->next)
+    if (const void* p = r->ptr.load(std::memory_order_seq_cst))
+      hazards.push_back(p);
+  std::sort(hazards.begin(), hazards.end());
+  size_t kept = 0;
+  for (size_t i = 0; i < pending.size(); ++i) {
+    if (std::binary_search(hazards.begin(), hazards.end(), pending[i].ptr))
+      pending[kept++] = pending[i];
+    else
+      pending[i].deleter(pending[i].ptr);
+  }
+  pending.erase(pending.begin() + kept, pending.end());
+}
+}  // namespace sync
+}  // namespace s21
+
+#endif
@@ -0,0 +1,221 @@
+#ifndef S21_MPMC_QUEUE_HPP
+#define S21_MPMC_QUEUE_HPP
+
+#include <stdbool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "../../s21_containers/s21_vector/s21_vector.h"
+#include "s21_sync.h"
+
+namespace s21 {
+// Bounded queue for any number of producers and consumers, after Dmitry
+// Vyukov's array queue. Every slot carries a sequence number that tells
+// whose turn it is: seq == pos means free for the producer holding ticket
+// pos, seq == pos + 1 means filled for the consumer holding ticket pos.
+// Producers and consumers only contend on their own ticket counter. Each
+// slot, each counter and each of the two event counts has a cache line to
+// itself. T's constructor must not throw once a ticket is taken, otherwise
+// the consumer holding that ticket never sees its slot filled.
+template <typename T>
+class mpmc_queue {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  explicit mpmc_queue(size_type capacity);
+  mpmc_queue(const mpmc_queue& q) = delete;
+  mpmc_queue& operator=(const mpmc_queue& q) = delete;
+  ~mpmc_queue();
+
+  bool try_push(const_reference value);
+  bool try_push(value_type&& value);
+  template <typename... Args>
+  bool try_emplace(Args&&... args);
+  bool try_pop(reference out);
+
+  void push(const_reference value);
+  void push(value_type&& value);
+  template <typename... Args>
+  void emplace(Args&&... args);
+  void pop(reference out);
+
+  bool empty() const;
+  size_type size() const;
+  size_type capacity() const;
+
+ private:
+  struct alignas(sync::cache_line) slot {
+    std::atomic<size_type> seq;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T* value() { return reinterpret_cast<T*>(storage); }
+  };
+
+  alignas(sync::cache_line) slot* slots;
+  size_type mask;
+
+  alignas(sync::cache_line) std::atomic<size_type> enqueue_pos;
+  alignas(sync::cache_line) std::atomic<size_type> dequeue_pos;
+
+  alignas(sync::cache_line) sync::event_count not_empty;
+  alignas(sync::cache_line) sync::event_count not_full;
+};
+
+template <typename T>
+mpmc_queue<T>::mpmc_queue(size_type capacity)
+    : slots(nullptr), mask(1), enqueue_pos(0), dequeue_pos(0) {
+  while (mask + 1 < capacity) mask = mask * 2 + 1;
+  slots = static_cast<slot*>(aligned_memory<sync::cache_line>::allocate(
+      (mask + 1) * sizeof(slot), alignof(slot)));
+  for (size_type i = 0; i <= mask; ++i) {
+    new (slots + i) slot;
+    slots[i].seq.store(i, std::memory_order_relaxed);
+  }
+}
+
+template <typename T>
+mpmc_queue<T>::~mpmc_queue() {
+  for (size_type i = dequeue_pos.load(); i != enqueue_pos.load(); ++i)
+    slots[i & mask].value()->~T();
+  for (size_type i = 0; i <= mask; ++i) slots[i].~slot();
+  aligned_memory<sync::cache_line>::deallocate(
+      slots, (mask + 1) * sizeof(slot), alignof(slot));
+}
+
+template <typename T>
+bool mpmc_queue<T>::try_push(const_reference value) {
+  return try_emplace(value);
+}
+
+template <typename T>
+bool mpmc_queue<T>::try_push(value_type&& value) {
+  return try_emplace(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+bool mpmc_queue<T>::try_emplace(Args&&... args) {
+  size_type pos = enqueue_pos.load(std::memory_order_relaxed);
+  slot* cell;
+  for (;;) {
+    cell = slots + (pos & mask);
+    size_type seq = cell->seq.load(std::memory_order_acquire);
+    std::intptr_t diff =
+        static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+    if (diff == 0) {
+      if (enqueue_pos.compare_exchange_weak(pos, pos + 1,
+                                            std::memory_order_relaxed))
+        break;
+    } else if (diff < 0) {
+      return false;
+    } else {
+      pos = enqueue_pos.load(std::memory_order_relaxed);
+    }
+  }
+  new (cell->value()) T(std::forward<Args>(args)...);
+  cell->seq.store(pos + 1, std::memory_order_release);
+  not_empty.notify_one();
+  return true;
+}
+
+template <typename T>
+bool mpmc_queue<T>::try_pop(reference out) {
+  size_type pos = dequeue_pos.load(std::memory_order_relaxed);
+  slot* cell;
+  for (;;) {
+    cell = slots + (pos & mask);
+    size_type seq = cell->seq.load(std::memory_order_acquire);
+    std::intptr_t diff =
+        static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+    if (diff == 0) {
+      if (dequeue_pos.compare_exchange_weak(pos, pos + 1,
+                                            std::memory_order_relaxed))
+        break;
+    } else if (diff < 0) {
+      return false;
+    } else {
+      pos = dequeue_pos.load(std::memory_order_relaxed);
+    }
+  }
+  out = std::move(*cell->value());
+  cell->value()->~T();
+  cell->seq.store(pos + mask + 1, std::memory_order_release);
+  not_full.notify_one();
+  return true;
+}
+
+template <typename T>
+void mpmc_queue<T>::push(const_reference value) {
+  emplace(value);
+}
+
+template <typename T>
+void mpmc_queue<T>::push(value_type&& value) {
+  emplace(std::move(value));
+}
+
+// Spins briefly, then sleeps on the futex until a consumer frees a slot.
+// The arguments are only consumed by the attempt that finds a free slot.
+template <typename T>
+template <typename... Args>
+void mpmc_queue<T>::emplace(Args&&... args) {
+  sync::backoff spin;
+  while (!try_emplace(std::forward<Args>(args)...)) {
+    if (spin.spinning()) {
+      spin.pause();
+      continue;
+    }
+    uint32_t key = not_full.prepare_wait();
+    if (try_emplace(std::forward<Args>(args)...)) {
+      not_full.cancel_wait();
+      break;
+    }
+    not_full.wait(key);
+  }
+}
+
+template <typename T>
+void mpmc_queue<T>::pop(reference out) {
+  sync::backoff spin;
+  while (!try_pop(out)) {
+    if (spin.spinning()) {
+      spin.pause();
+      continue;
+    }
+    uint32_t key = not_empty.prepare_wait();
+    if (try_pop(out)) {
+      not_empty.cancel_wait();
+      break;
+    }
+    not_empty.wait(key);
+  }
+}
+
+template <typename T>
+bool mpmc_queue<T>::empty() const {
+  return size() == 0;
+}
+
+// A snapshot; with concurrent pushes and pops it may be out of date by the
+// time it returns.
+template <typename T>
+size_t mpmc_queue<T>::size() const {
+  size_type head = dequeue_pos.load(std::memory_order_acquire);
+  size_type tail = enqueue_pos.load(std::memory_order_acquire);
+  return tail > head ? std::min(tail - head, mask + 1) : 0;
+}
+
+template <typename T>
+size_t mpmc_queue<T>::capacity() const {
+  return mask + 1;
+}
+}  // namespace s21
+
+#endif
@@ -0,0 +1,220 @@
+#ifndef S21_SPSC_QUEUE_HPP
+#define S21_SPSC_QUEUE_HPP
+
+#include <stdbool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../../s21_containers/s21_vector/s21_vector.h"
+#include "s21_sync.h"
+
+namespace s21 {
+// Bounded ring buffer for exactly one producer thread and one consumer
+// thread. head is written only by the consumer and tail only by the
+// producer, each on its own cache line; each side also keeps a private copy
+// of the other's index and rereads the shared one only when the copy says
+// the ring is full or empty.
+template <typename T>
+class spsc_queue {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  explicit spsc_queue(size_type capacity);
+  spsc_queue(const spsc_queue& q) = delete;
+  spsc_queue& operator=(const spsc_queue& q) = delete;
+  ~spsc_queue();
+
+  // Producer side.
+  bool try_push(const_reference value);
+  bool try_push(value_type&& value);
+  template <typename... Args>
+  bool try_emplace(Args&&... args);
+  template <typename InputIt>
+  size_type try_push_n(InputIt first, size_type count);
+  void push(const_reference value);
+  void push(value_type&& value);
+  template <typename... Args>
+  void emplace(Args&&... args);
+
+  // Consumer side.
+  reference front();
+  void pop();
+  bool try_pop(reference out);
+  template <typename OutputIt>
+  size_type try_pop_n(OutputIt out, size_type count);
+
+  bool empty() const;
+  size_type size() const;
+  size_type capacity() const;
+
+ private:
+  alignas(sync::cache_line) T* slots;
+  size_type mask;
+
+  alignas(sync::cache_line) std::atomic<size_type> head;
+  size_type tail_cache;
+
+  alignas(sync::cache_line) std::atomic<size_type> tail;
+  size_type head_cache;
+
+  size_type free_slots(size_type t, size_type wanted);
+  size_type ready_slots(size_type h, size_type wanted);
+};
+
+template <typename T>
+spsc_queue<T>::spsc_queue(size_type capacity)
+    : slots(nullptr), mask(1), head(0), tail_cache(0), tail(0), head_cache(0) {
+  while (mask + 1 < capacity) mask = mask * 2 + 1;
+  slots = static_cast<T*>(
+      aligned_memory<sync::cache_line>::allocate((mask + 1) * sizeof(T),
+                                                 alignof(T)));
+}
+
+template <typename T>
+spsc_queue<T>::~spsc_queue() {
+  if (!std::is_trivially_destructible<T>::value)
+    for (size_type i = head.load(); i != tail.load(); ++i)
+      slots[i & mask].~T();
+  aligned_memory<sync::cache_line>::deallocate(slots, (mask + 1) * sizeof(T),
+                                               alignof(T));
+}
+
+template <typename T>
+bool spsc_queue<T>::try_push(const_reference value) {
+  return try_emplace(value);
+}
+
+template <typename T>
+bool spsc_queue<T>::try_push(value_type&& value) {
+  return try_emplace(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+bool spsc_queue<T>::try_emplace(Args&&... args) {
+  size_type t = tail.load(std::memory_order_relaxed);
+  if (free_slots(t, 1) == 0) return false;
+  new (slots + (t & mask)) T(std::forward<Args>(args)...);
+  tail.store(t + 1, std::memory_order_release);
+  return true;
+}
+
+// Publishes the whole batch with a single release store.
+template <typename T>
+template <typename InputIt>
+size_t spsc_queue<T>::try_push_n(InputIt first, size_type count) {
+  size_type t = tail.load(std::memory_order_relaxed);
+  count = std::min(count, free_slots(t, count));
+  for (size_type i = 0; i < count; ++i, ++first)
+    new (slots + ((t + i) & mask)) T(*first);
+  tail.store(t + count, std::memory_order_release);
+  return count;
+}
+
+template <typename T>
+void spsc_queue<T>::push(const_reference value) {
+  emplace(value);
+}
+
+template <typename T>
+void spsc_queue<T>::push(value_type&& value) {
+  emplace(std::move(value));
+}
+
+// The arguments are only consumed by the attempt that finds a free slot.
+template <typename T>
+template <typename... Args>
+void spsc_queue<T>::emplace(Args&&... args) {
+  sync::backoff wait;
+  while (!try_emplace(std::forward<Args>(args)...)) wait.pause();
+}
+
+template <typename T>
+T& spsc_queue<T>::front() {
+  size_type h = head.load(std::memory_order_relaxed);
+  if (ready_slots(h, 1) == 0)
+    throw std::logic_error("get front from empty Queue");
+  return slots[h & mask];
+}
+
+template <typename T>
+void spsc_queue<T>::pop() {
+  size_type h = head.load(std::memory_order_relaxed);
+  if (ready_slots(h, 1) > 0) {
+    slots[h & mask].~T();
+    head.store(h + 1, std::memory_order_release);
+  }
+}
+
+template <typename T>
+bool spsc_queue<T>::try_pop(reference out) {
+  size_type h = head.load(std::memory_order_relaxed);
+  if (ready_slots(h, 1) == 0) return false;
+  T& slot = slots[h & mask];
+  out = std::move(slot);
+  slot.~T();
+  head.store(h + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+template <typename OutputIt>
+size_t spsc_queue<T>::try_pop_n(OutputIt out, size_type count) {
+  size_type h = head.load(std::memory_order_relaxed);
+  count = std::min(count, ready_slots(h, count));
+  for (size_type i = 0; i < count; ++i, ++out) {
+    T& slot = slots[(h + i) & mask];
+    *out = std::move(slot);
+    slot.~T();
+  }
+  head.store(h + count, std::memory_order_release);
+  return count;
+}
+
+template <typename T>
+bool spsc_queue<T>::empty() const {
+  return size() == 0;
+}
+
+// Exact when called from either end; an estimate from any other thread.
+template <typename T>
+size_t spsc_queue<T>::size() const {
+  size_type h = head.load(std::memory_order_acquire);
+  size_type t = tail.load(std::memory_order_acquire);
+  return std::min(t - h, mask + 1);
+}
+
+template <typename T>
+size_t spsc_queue<T>::capacity() const {
+  return mask + 1;
+}
+
+template <typename T>
+size_t spsc_queue<T>::free_slots(size_type t, size_type wanted) {
+  size_type free = mask + 1 - (t - head_cache);
+  if (free < wanted) {
+    head_cache = head.load(std::memory_order_acquire);
+    free = mask + 1 - (t - head_cache);
+  }
+  return free;
+}
+
+template <typename T>
+size_t spsc_queue<T>::ready_slots(size_type h, size_type wanted) {
+  size_type ready = tail_cache - h;
+  if (ready < wanted) {
+    tail_cache = tail.load(std::memory_order_acquire);
+    ready = tail_cache - h;
+  }
+  return ready;
+}
+}  // namespace s21
+
+#endif
@@ -0,0 +1,130 @@
+#ifndef S21_SYNC_HPP
+#define S21_SYNC_HPP
+
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace s21 {
+namespace sync {
+constexpr size_t cache_line = 64;
+
+inline void cpu_relax() {
+#if defined(__SSE2__)
+  _mm_pause();
+#elif defined(__aarch64__)
+  asm volatile("yield");
+#endif
+}
+
+// Spins with a pause instruction for the first few rounds, then yields the
+// time slice so a waiting thread does not starve the one it waits for.
+class backoff {
+ public:
+  backoff() : rounds(0) {}
+
+  void pause() {
+    if (rounds < spin_rounds) {
+      for (unsigned i = 0; i < (1u << rounds); ++i) cpu_relax();
+      ++rounds;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+
+  bool spinning() const { return rounds < spin_rounds; }
+  void reset() { rounds = 0; }
+
+ private:
+  static constexpr unsigned spin_rounds = 7;
+  unsigned rounds;
+};
+
+// Sleeps while word still holds expected. May return spuriously, so callers
+// re-check their condition in a loop. Outside Linux this degrades to a
+// yield.
+inline void futex_wait(std::atomic<uint32_t>& word, uint32_t expected) {
+#if defined(__linux__)
+  static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+                "futex word must be a plain 32-bit integer");
+  ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT_PRIVATE,
+            expected, nullptr, nullptr, 0);
+#else
+  if (word.load() == expected) std::this_thread::yield();
+#endif
+}
+
+inline void futex_wake(std::atomic<uint32_t>& word, int count = INT_MAX) {
+#if defined(__linux__)
+  ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE_PRIVATE,
+            count, nullptr, nullptr, 0);
+#else
+  (void)word;
+  (void)count;
+#endif
+}
+
+// Lets a thread sleep until another thread changes some condition without
+// the notifier paying for a syscall when nobody sleeps. A waiter calls
+// prepare_wait(), re-checks its condition, and then either cancel_wait()s
+// or wait()s with the returned key; a notifier changes the condition first
+// and calls notify_*() afterwards.
+class event_count {
+ public:
+  event_count() : epoch(0), waiters(0) {}
+
+  uint32_t prepare_wait() {
+    waiters.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return epoch.load(std::memory_order_acquire);
+  }
+
+  void cancel_wait() { waiters.fetch_sub(1, std::memory_order_relaxed); }
+
+  void wait(uint32_t key) {
+    while (epoch.load(std::memory_order_acquire) == key) futex_wait(epoch, key);
+    waiters.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  // Unordered peek at the sleepers, for notifiers that can live with a
+  // missed wake-up and want to skip even the fence in notify_*().
+  bool maybe_waiting() const {
+    return waiters.load(std::memory_order_relaxed) > 0;
+  }
+
+  void notify_one() { notify(1); }
+  void notify_all() { notify(INT_MAX); }
+
+ private:
+  std::atomic<uint32_t> epoch;
+  std::atomic<uint32_t> waiters;
+
+  // This fence and the one in prepare_wait() order the caller's earlier
+  // change of the condition against a concurrent waiter: either this sees
+  // the new waiter, or the waiter's re-check sees the change. With nobody
+  // waiting a notify is a fence and a plain load, and never writes the
+  // shared line.
+  void notify(int count) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiters.load(std::memory_order_relaxed) > 0) {
+      epoch.fetch_add(1, std::memory_order_release);
+      futex_wake(epoch, count);
+    }
+  }
+};
+}  // namespace sync
+}  // namespace s21
+
+#endif
@@ -0,0 +1,165 @@
+#ifndef S21_WORK_STEALING_DEQUE_HPP
+#define S21_WORK_STEALING_DEQUE_HPP
+
+#include <stdbool.h>
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+#include "../../s21_containers/s21_vector/s21_vector.h"
+#include "s21_sync.h"
+
+namespace s21 {
+// Chase-Lev deque (Chase and Lev, 2005; memory orders after Le et al.,
+// 2013). One owner thread pushes and pops at the bottom without contention;
+// any number of thieves take from the top, and only the last element is
+// ever raced for. The ring grows when full; a thief may still be reading
+// the old ring, so replaced rings are kept until the deque is destroyed.
+// Slots are read while they may be rewritten, so T must be trivially
+// copyable, typically a pointer to a task.
+//
+// The Dekker-style handshake between pop() and steal() on bottom and top is
+// done with seq_cst accesses rather than stand-alone fences, which costs the
+// same on x86 and is understood by ThreadSanitizer.
+template <typename T>
+class work_stealing_deque {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "work_stealing_deque needs a trivially copyable T");
+
+ public:
+  using value_type = T;
+  using reference = T&;
+  using size_type = size_t;
+
+  explicit work_stealing_deque(size_type capacity = 64);
+  work_stealing_deque(const work_stealing_deque& d) = delete;
+  work_stealing_deque& operator=(const work_stealing_deque& d) = delete;
+  ~work_stealing_deque();
+
+  // Owner side.
+  void push(T value);
+  bool pop(reference out);
+
+  // Any thread. Fails when empty or when another thread won the race.
+  bool steal(reference out);
+
+  bool empty() const;
+  size_type size() const;
+  size_type capacity() const;
+
+ private:
+  struct ring {
+    int64_t mask;
+    std::atomic<T>* slots;
+
+    explicit ring(int64_t capacity)
+        : mask(capacity - 1), slots(new std::atomic<T>[capacity]) {}
+    ~ring() { delete[] slots; }
+
+    T get(int64_t i) const {
+      return slots[i & mask].load(std::memory_order_relaxed);
+    }
+    void put(int64_t i, T value) {
+      slots[i & mask].store(value, std::memory_order_relaxed);
+    }
+  };
+
+  alignas(sync::cache_line) std::atomic<int64_t> top;
+  alignas(sync::cache_line) std::atomic<int64_t> bottom;
+  std::atomic<ring*> items;
+  vector<ring*> retired;
+
+  ring* grow(ring* old, int64_t t, int64_t b);
+};
+
+template <typename T>
+work_stealing_deque<T>::work_stealing_deque(size_type capacity)
+    : top(0), bottom(0), items(nullptr), retired() {
+  int64_t cap = 2;
+  while (cap < static_cast<int64_t>(capacity)) cap *= 2;
+  items.store(new ring(cap), std::memory_order_relaxed);
+}
+
+template <typename T>
+work_stealing_deque<T>::~work_stealing_deque() {
+  delete items.load();
+  for (size_type i = 0; i < retired.size(); ++i) delete retired[i];
+}
+
+template <typename T>
+void work_stealing_deque<T>::push(T value) {
+  int64_t b = bottom.load(std::memory_order_relaxed);
+  int64_t t = top.load(std::memory_order_acquire);
+  ring* r = items.load(std::memory_order_relaxed);
+  if (b - t > r->mask) r = grow(r, t, b);
+  r->put(b, value);
+  bottom.store(b + 1, std::memory_order_release);
+}
+
+// Claims the bottom slot first and only then looks at top, so a thief that
+// read the old bottom and this pop cannot both take the last element
+// without one of them losing the CAS on top.
+template <typename T>
+bool work_stealing_deque<T>::pop(reference out) {
+  int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+  ring* r = items.load(std::memory_order_relaxed);
+  bottom.store(b, std::memory_order_seq_cst);
+  int64_t t = top.load(std::memory_order_seq_cst);
+  if (t > b) {
+    bottom.store(b + 1, std::memory_order_relaxed);
+    return false;
+  }
+  out = r->get(b);
+  if (t < b) return true;
+  bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                         std::memory_order_relaxed);
+  bottom.store(b + 1, std::memory_order_relaxed);
+  return won;
+}
+
+template <typename T>
+bool work_stealing_deque<T>::steal(reference out) {
+  int64_t t = top.load(std::memory_order_seq_cst);
+  int64_t b = bottom.load(std::memory_order_seq_cst);
+  if (t >= b) return false;
+  ring* r = items.load(std::memory_order_acquire);
+  T value = r->get(t);
+  if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                   std::memory_order_relaxed))
+    return false;
+  out = value;
+  return true;
+}
+
+// Approximate unless called by the owner.
+template <typename T>
+bool work_stealing_deque<T>::empty() const {
+  return size() == 0;
+}
+
+template <typename T>
+size_t work_stealing_deque<T>::size() const {
+  int64_t b = bottom.load(std::memory_order_seq_cst);
+  int64_t t = top.load(std::memory_order_seq_cst);
+  return b > t ? static_cast<size_type>(b - t) : 0;
+}
+
+template <typename T>
+size_t work_stealing_deque<T>::capacity() const {
+  ring* r = items.load(std::memory_order_relaxed);
+  return static_cast<size_type>(r->mask + 1);
+}
+
+template <typename T>
+typename work_stealing_deque<T>::ring* work_stealing_deque<T>::grow(
+    ring* old, int64_t t, int64_t b) {
+  ring* r = new ring(2 * (old->mask + 1));
+  for (int64_t i = t; i < b; ++i) r->put(i, old->get(i));
+  retired.push_back(old);
+  items.store(r, std::memory_order_release);
+  return r;
+}
+}  // namespace s21
+
+#endif
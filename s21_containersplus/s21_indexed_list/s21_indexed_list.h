@@ -0,0 +1,642 @@
+#ifndef S21_INDEXED_LIST_HPP
+#define S21_INDEXED_LIST_HPP
+
+#include <stdbool.h>
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../../s21_containers/s21_list/s21_list.h"
+
+namespace s21 {
+// Sequence stored as an AVL tree ordered by position: every node keeps the
+// size of its subtree, so finding, inserting or erasing the element at an
+// index takes O(log n). Nodes are never relocated, so iterators stay valid
+// until their own element is erased. An iterator finds its position from
+// its node's parent links alone, so it keeps working after swap() or a move
+// hands the node to another list; only end() refers to the list object.
+template <typename T>
+class indexed_list {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  class node {
+    value_type value;
+    node* left;
+    node* right;
+    node* parent;
+    size_type count;
+    int height;
+
+   public:
+    template <typename... Args>
+    node(Args&&... args)
+        : value(std::forward<Args>(args)...),
+          left(nullptr),
+          right(nullptr),
+          parent(nullptr),
+          count(1),
+          height(1) {}
+    friend class indexed_list;
+  };
+
+  class const_iterator {
+   public:
+    const_iterator() : owner(nullptr), ptr(nullptr) {}
+    const_iterator(const indexed_list* list, node* nd)
+        : owner(list), ptr(nd) {}
+
+    bool operator!=(const const_iterator& other) const {
+      return ptr != other.ptr;
+    }
+    bool operator==(const const_iterator& other) const {
+      return ptr == other.ptr;
+    }
+    const_reference operator*() const { return ptr->value; }
+
+    const_iterator operator++(int) {
+      const_iterator tmp(*this);
+      ptr = next(ptr);
+      return tmp;
+    }
+
+    const_iterator& operator++() {
+      ptr = next(ptr);
+      return *this;
+    }
+
+    const_iterator operator--(int) {
+      const_iterator tmp(*this);
+      decrement();
+      return tmp;
+    }
+
+    const_iterator& operator--() {
+      decrement();
+      return *this;
+    }
+
+    const_iterator operator+(size_type n) const {
+      auto it_tmp = *this;
+      return it_tmp += n;
+    }
+
+    const_iterator operator-(size_type n) const {
+      auto it_tmp = *this;
+      return it_tmp -= n;
+    }
+
+    const_iterator& operator+=(size_type n) {
+      ptr = ptr ? select(root_of(ptr), rank(ptr) + n)
+                : owner->node_at(owner->size() + n);
+      return *this;
+    }
+
+    const_iterator& operator-=(size_type n) {
+      ptr = ptr ? select(root_of(ptr), rank(ptr) - n)
+                : owner->node_at(owner->size() - n);
+      return *this;
+    }
+
+    size_type index() const { return ptr ? rank(ptr) : owner->size(); }
+
+   protected:
+    const indexed_list* owner;
+    node* ptr;
+
+    void decrement() {
+      ptr = ptr ? prev(ptr) : owner->last();
+    }
+
+    friend class indexed_list;
+  };
+
+  class iterator : public const_iterator {
+   public:
+    iterator() : const_iterator() {}
+    iterator(const indexed_list* list, node* nd) : const_iterator(list, nd) {}
+    iterator(const const_iterator& other) : const_iterator(other) {}
+
+    reference operator*() const { return this->ptr->value; }
+    friend class indexed_list;
+  };
+
+  indexed_list();
+  indexed_list(size_type n);
+  indexed_list(std::initializer_list<value_type> const& items);
+  indexed_list(const indexed_list& other);
+  indexed_list(indexed_list&& other);
+  ~indexed_list();
+
+  indexed_list& operator=(const indexed_list& other);
+  indexed_list& operator=(indexed_list&& other);
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  const_reference front() const;
+  const_reference back() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  void clear();
+  iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, value_type&& value);
+  iterator insert_at(size_type pos, const_reference value);
+  void erase(const_iterator pos);
+  void erase_at(size_type pos);
+  void push_back(const_reference data);
+  void push_front(const_reference data);
+  void pop_front();
+  void pop_back();
+  void swap(indexed_list& other);
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args&&... args);
+
+  template <typename... Args>
+  void insert_many_back(Args&&... args);
+
+  template <typename... Args>
+  void insert_many_front(Args&&... args);
+
+  void print();
+
+ private:
+  node* root;
+  node_pool<node>* pool;
+
+  static size_type count_of(node* n);
+  static int height_of(node* n);
+  static void update(node* n);
+  static node* rotate_left(node* n);
+  static node* rotate_right(node* n);
+  static node* balance(node* n);
+  static node* next(node* n);
+  static node* prev(node* n);
+  static node* root_of(node* n);
+  static size_type rank(node* n);
+  static node* select(node* n, size_type pos);
+
+  node* node_at(size_type pos) const;
+  size_type index_of(node* n) const;
+  node* last() const;
+  node* link(node* n, size_type pos, node* added);
+  node* unlink(node* n, size_type pos, node*& removed);
+  static node* unlink_min(node* n, node*& removed);
+  void destroy_values(node* n);
+  void destroy_node(node* n);
+};
+
+template <typename T>
+indexed_list<T>::indexed_list() : root(nullptr), pool(nullptr) {}
+
+template <typename T>
+indexed_list<T>::indexed_list(size_t n) : indexed_list() {
+  while (n-- > 0) emplace(end());
+}
+
+template <typename T>
+indexed_list<T>::indexed_list(std::initializer_list<T> const& items)
+    : indexed_list() {
+  for (const T& el : items) push_back(el);
+}
+
+template <typename T>
+indexed_list<T>::indexed_list(const indexed_list& other) : indexed_list() {
+  for (const T& el : other) push_back(el);
+}
+
+template <typename T>
+indexed_list<T>::indexed_list(indexed_list&& other) : indexed_list() {
+  swap(other);
+}
+
+template <typename T>
+indexed_list<T>::~indexed_list() {
+  clear();
+}
+
+template <typename T>
+indexed_list<T>& indexed_list<T>::operator=(const indexed_list& other) {
+  if (this != &other) {
+    indexed_list tmp(other);
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename T>
+indexed_list<T>& indexed_list<T>::operator=(indexed_list&& other) {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename T>
+typename indexed_list<T>::iterator indexed_list<T>::begin() {
+  return iterator(this, node_at(0));
+}
+
+template <typename T>
+typename indexed_list<T>::iterator indexed_list<T>::end() {
+  return iterator(this, nullptr);
+}
+
+template <typename T>
+typename indexed_list<T>::const_iterator indexed_list<T>::begin() const {
+  return const_iterator(this, node_at(0));
+}
+
+template <typename T>
+typename indexed_list<T>::const_iterator indexed_list<T>::end() const {
+  return const_iterator(this, nullptr);
+}
+
+template <typename T>
+T& indexed_list<T>::at(size_type pos) {
+  if (pos >= size()) throw std::out_of_range("Index out of range");
+  return node_at(pos)->value;
+}
+
+template <typename T>
+const T& indexed_list<T>::at(size_type pos) const {
+  if (pos >= size()) throw std::out_of_range("Index out of range");
+  return node_at(pos)->value;
+}
+
+template <typename T>
+T& indexed_list<T>::operator[](size_type pos) {
+  return node_at(pos)->value;
+}
+
+template <typename T>
+const T& indexed_list<T>::operator[](size_type pos) const {
+  return node_at(pos)->value;
+}
+
+template <typename T>
+const T& indexed_list<T>::front() const {
+  return at(0);
+}
+
+template <typename T>
+const T& indexed_list<T>::back() const {
+  if (!root) throw std::out_of_range("Index out of range");
+  return last()->value;
+}
+
+template <typename T>
+bool indexed_list<T>::empty() const {
+  return root == nullptr;
+}
+
+template <typename T>
+size_t indexed_list<T>::size() const {
+  return count_of(root);
+}
+
+template <typename T>
+size_t indexed_list<T>::max_size() const {
+  return (std::numeric_limits<std::size_t>::max() / sizeof(node) / 2);
+}
+
+template <typename T>
+void indexed_list<T>::clear() {
+  size_type n = size();
+  if (!std::is_trivially_destructible<T>::value) destroy_values(root);
+  root = nullptr;
+  if (pool) pool->release(n);
+  pool = nullptr;
+}
+
+template <typename T>
+typename indexed_list<T>::iterator indexed_list<T>::insert(
+    const_iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename T>
+typename indexed_list<T>::iterator indexed_list<T>::insert(
+    const_iterator pos, value_type&& value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename T>
+typename indexed_list<T>::iterator indexed_list<T>::insert_at(
+    size_type pos, const_reference value) {
+  if (pos > size()) throw std::out_of_range("Index out of range");
+  return emplace(const_iterator(this, node_at(pos)), value);
+}
+
+template <typename T>
+void indexed_list<T>::erase(const_iterator pos) {
+  if (pos.ptr) erase_at(index_of(pos.ptr));
+}
+
+template <typename T>
+void indexed_list<T>::erase_at(size_type pos) {
+  if (pos >= size()) throw std::out_of_range("Index out of range");
+  node* removed = nullptr;
+  root = unlink(root, pos, removed);
+  if (root) root->parent = nullptr;
+  destroy_node(removed);
+}
+
+template <typename T>
+void indexed_list<T>::push_back(const_reference data) {
+  emplace(end(), data);
+}
+
+template <typename T>
+void indexed_list<T>::push_front(const_reference data) {
+  emplace(begin(), data);
+}
+
+template <typename T>
+void indexed_list<T>::pop_front() {
+  erase_at(0);
+}
+
+template <typename T>
+void indexed_list<T>::pop_back() {
+  if (!root) throw std::out_of_range("Index out of range");
+  erase_at(size() - 1);
+}
+
+template <typename T>
+void indexed_list<T>::swap(indexed_list& other) {
+  std::swap(root, other.root);
+  std::swap(pool, other.pool);
+}
+
+template <typename T>
+template <typename... Args>
+typename indexed_list<T>::iterator indexed_list<T>::emplace(
+    const_iterator pos, Args&&... args) {
+  size_type index = pos.ptr ? index_of(pos.ptr) : size();
+  if (!pool) pool = node_pool<node>::create();
+  node* mem = pool->allocate();
+  node* added;
+  try {
+    added = new (mem) node(std::forward<Args>(args)...);
+  } catch (...) {
+    pool->deallocate(mem);
+    throw;
+  }
+  root = link(root, index, added);
+  root->parent = nullptr;
+  return iterator(this, added);
+}
+
+template <typename T>
+template <typename... Args>
+typename indexed_list<T>::iterator indexed_list<T>::insert_many(
+    const_iterator pos, Args&&... args) {
+  (emplace(pos, std::forward<Args>(args)), ...);
+  return iterator(pos);
+}
+
+template <typename T>
+template <typename... Args>
+void indexed_list<T>::insert_many_back(Args&&... args) {
+  (emplace(end(), std::forward<Args>(args)), ...);
+}
+
+template <typename T>
+template <typename... Args>
+void indexed_list<T>::insert_many_front(Args&&... args) {
+  insert_many(begin(), std::forward<Args>(args)...);
+}
+
+template <typename T>
+size_t indexed_list<T>::count_of(node* n) {
+  return n ? n->count : 0;
+}
+
+template <typename T>
+int indexed_list<T>::height_of(node* n) {
+  return n ? n->height : 0;
+}
+
+template <typename T>
+void indexed_list<T>::update(node* n) {
+  n->count = 1 + count_of(n->left) + count_of(n->right);
+  n->height = 1 + std::max(height_of(n->left), height_of(n->right));
+}
+
+template <typename T>
+typename indexed_list<T>::node* indexed_list<T>::rotate_left(node* n) {
+  node* r = n->right;
+  n->right = r->left;
+  if (n->right) n->right->parent = n;
+  r->left = n;
+  r->parent = n->parent;
+  n->parent = r;
+  update(n);
+  update(r);
+  return r;
+}
+
+template <typename T>
+typename indexed_list<T>::node* indexed_list<T>::rotate_right(node* n) {
+  node* l = n->left;
+  n->left = l->right;
+  if (n->left) n->left->parent = n;
+  l->right = n;
+  l->parent = n->parent;
+  n->parent = l;
+  update(n);
+  update(l);
+  return l;
+}
+
+template <typename T>
+typename indexed_list<T>::node* indexed_list<T>::balance(node* n) {
+  update(n);
+  int diff = height_of(n->left) - height_of(n->right);
+  if (diff > 1) {
+    if (height_of(n->left->left) < height_of(n->left->right))
+      n->left = rotate_left(n->left);
+    n = rotate_right(n);
+  } else if (diff < -1) {
+    if (height_of(n->right->right) < height_of(n->right->left))
+      n->right = rotate_right(n->right);
+    n = rotate_left(n);
+  }
+  return n;
+}
+
+template <typename T>
+typename indexed_list<T>::node* indexed_list<T>::next(node* n) {
+  if (n->right) {
+    n = n->right;
+    while (n->left) n = n->left;
+    return n;
+  }
+  while (n->parent && n->parent->right == n) n = n->parent;
+  return n->parent;
+}
+
+template <typename T>
+typename indexed_list<T>::node* indexed_list<T>::prev(node* n) {
+  if (n->left) {
+    n = n->left;
+    while (n->right) n = n->right;
+    return n;
+  }
+  while (n->parent && n->parent->left == n) n = n->parent;
+  return n->parent;
+}
+
+template <typename T>
+typename indexed_list<T>::node* indexed_list<T>::root_of(node* n) {
+  while (n->parent) n = n->parent;
+  return n;
+}
+
+// Position of n within its tree, from the parent links alone.
+template <typename T>
+size_t indexed_list<T>::rank(node* n) {
+  size_type pos = count_of(n->left);
+  for (; n->parent; n = n->parent)
+    if (n->parent->right == n) pos += count_of(n->parent->left) + 1;
+  return pos;
+}
+
+// Node at pos within the subtree rooted at n, or nullptr past its end.
+template <typename T>
+typename indexed_list<T>::node* indexed_list<T>::select(node* n,
+                                                        size_type pos) {
+  while (n) {
+    size_type left = count_of(n->left);
+    if (pos == left) break;
+    if (pos < left) {
+      n = n->left;
+    } else {
+      pos -= left + 1;
+      n = n->right;
+    }
+  }
+  return n;
+}
+
+// Returns nullptr for pos == size(), which is how end() is represented.
+template <typename T>
+typename indexed_list<T>::node* indexed_list<T>::node_at(
+    size_type pos) const {
+  return select(root, pos);
+}
+
+template <typename T>
+size_t indexed_list<T>::index_of(node* n) const {
+  return n ? rank(n) : size();
+}
+
+template <typename T>
+typename indexed_list<T>::node* indexed_list<T>::last() const {
+  node* n = root;
+  while (n && n->right) n = n->right;
+  return n;
+}
+
+template <typename T>
+typename indexed_list<T>::node* indexed_list<T>::link(node* n, size_type pos,
+                                                      node* added) {
+  if (!n) return added;
+  size_type left = count_of(n->left);
+  if (pos <= left) {
+    n->left = link(n->left, pos, added);
+    n->left->parent = n;
+  } else {
+    n->right = link(n->right, pos - left - 1, added);
+    n->right->parent = n;
+  }
+  return balance(n);
+}
+
+// Detaches the node at pos and returns the new subtree root; the detached
+// node is handed back through removed. Nodes are relinked rather than
+// having their values swapped, so iterators to other elements survive.
+template <typename T>
+typename indexed_list<T>::node* indexed_list<T>::unlink(node* n,
+                                                        size_type pos,
+                                                        node*& removed) {
+  size_type left = count_of(n->left);
+  if (pos < left) {
+    n->left = unlink(n->left, pos, removed);
+    if (n->left) n->left->parent = n;
+  } else if (pos > left) {
+    n->right = unlink(n->right, pos - left - 1, removed);
+    if (n->right) n->right->parent = n;
+  } else {
+    removed = n;
+    if (!n->left || !n->right) return n->left ? n->left : n->right;
+    node* successor = nullptr;
+    node* right = unlink_min(n->right, successor);
+    successor->left = n->left;
+    successor->right = right;
+    successor->left->parent = successor;
+    if (right) right->parent = successor;
+    n = successor;
+  }
+  return balance(n);
+}
+
+template <typename T>
+typename indexed_list<T>::node* indexed_list<T>::unlink_min(node* n,
+                                                            node*& removed) {
+  if (!n->left) {
+    removed = n;
+    return n->right;
+  }
+  n->left = unlink_min(n->left, removed);
+  if (n->left) n->left->parent = n;
+  return balance(n);
+}
+
+template <typename T>
+void indexed_list<T>::destroy_values(node* n) {
+  if (n) {
+    destroy_values(n->left);
+    destroy_values(n->right);
+    n->~node();
+  }
+}
+
+template <typename T>
+void indexed_list<T>::destroy_node(node* n) {
+  n->~node();
+  pool->deallocate(n);
+}
+
+template <typename T>
+void indexed_list<T>::print() {
+  std::cout << "size: " << size() << '\n';
+  for (const T& el : *this) std::cout << el << ' ';
+  std::cout << "\n\n";
+}
+}  // namespace s21
+
+#endif
@@ -0,0 +1,411 @@
+#ifndef S21_INTRUSIVE_LIST_HPP
+#define S21_INTRUSIVE_LIST_HPP
+
+#include <stdbool.h>
+
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+// Links embedded in a user object. Copying an object gives an unlinked hook,
+// so copies never join the list of the original.
+class intrusive_list_hook {
+ public:
+  intrusive_list_hook() : next(nullptr), prev(nullptr) {}
+  intrusive_list_hook(const intrusive_list_hook&) : intrusive_list_hook() {}
+  intrusive_list_hook& operator=(const intrusive_list_hook&) { return *this; }
+
+  bool is_linked() const { return next != nullptr; }
+
+ private:
+  intrusive_list_hook* next;
+  intrusive_list_hook* prev;
+
+  template <typename T, intrusive_list_hook T::*Hook>
+  friend class intrusive_list;
+};
+
+// List of objects that are linked through their Hook member, so no node is
+// ever allocated and an object can be unlinked in O(1) given only a
+// reference to it. The list does not own its elements: they must outlive
+// their membership, and clear() only unlinks them.
+template <typename T, intrusive_list_hook T::*Hook>
+class intrusive_list {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+  using hook = intrusive_list_hook;
+
+  class const_iterator {
+   public:
+    const_iterator() : ptr(nullptr) {}
+    const_iterator(hook* h) : ptr(h) {}
+
+    bool operator!=(const const_iterator& other) const {
+      return ptr != other.ptr;
+    }
+    bool operator==(const const_iterator& other) const {
+      return ptr == other.ptr;
+    }
+    const_reference operator*() const { return *owner(ptr); }
+    const value_type* operator->() const { return owner(ptr); }
+
+    const_iterator operator++(int) {
+      const_iterator tmp(*this);
+      ptr = ptr->next;
+      return tmp;
+    }
+
+    const_iterator& operator++() {
+      ptr = ptr->next;
+      return *this;
+    }
+
+    const_iterator operator--(int) {
+      const_iterator tmp(*this);
+      ptr = ptr->prev;
+      return tmp;
+    }
+
+    const_iterator& operator--() {
+      ptr = ptr->prev;
+      return *this;
+    }
+
+   protected:
+    hook* ptr;
+
+    friend class intrusive_list;
+  };
+
+  class iterator : public const_iterator {
+   public:
+    iterator() : const_iterator() {}
+    iterator(hook* h) : const_iterator(h) {}
+
+    reference operator*() const { return *owner(this->ptr); }
+    value_type* operator->() const { return owner(this->ptr); }
+    friend class intrusive_list;
+  };
+
+  intrusive_list();
+  intrusive_list(const intrusive_list& other) = delete;
+  intrusive_list(intrusive_list&& other);
+  ~intrusive_list();
+
+  intrusive_list& operator=(const intrusive_list& other) = delete;
+  intrusive_list& operator=(intrusive_list&& other);
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  static iterator iterator_to(reference value);
+
+  reference front();
+  reference back();
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  void clear();
+  iterator insert(const_iterator pos, reference value);
+  void erase(const_iterator pos);
+  void erase(reference value);
+  void push_back(reference value);
+  void push_front(reference value);
+  void pop_front();
+  void pop_back();
+  void swap(intrusive_list& other);
+  void splice(const_iterator pos, intrusive_list& other);
+  void splice(const_iterator pos, intrusive_list& other, const_iterator it);
+  void splice(const_iterator pos, intrusive_list& other, const_iterator first,
+              const_iterator last);
+  void reverse();
+
+  void print();
+
+ private:
+  hook root;
+  size_type sz;
+
+  static std::ptrdiff_t offset();
+  static T* owner(hook* h);
+  static void unlink(hook* first, hook* last);
+  static void link_before(hook* pos, hook* first, hook* last);
+  void take_root(intrusive_list& other);
+  bool contains(const hook* h) const;
+};
+
+template <typename T, intrusive_list_hook T::*Hook>
+intrusive_list<T, Hook>::intrusive_list() : sz(0) {
+  root.next = root.prev = &root;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+intrusive_list<T, Hook>::intrusive_list(intrusive_list&& other)
+    : intrusive_list() {
+  take_root(other);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+intrusive_list<T, Hook>::~intrusive_list() {
+  clear();
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+intrusive_list<T, Hook>& intrusive_list<T, Hook>::operator=(
+    intrusive_list&& other) {
+  if (this != &other) {
+    clear();
+    take_root(other);
+  }
+  return *this;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::begin() {
+  return iterator(root.next);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::end() {
+  return iterator(&root);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::const_iterator
+intrusive_list<T, Hook>::begin() const {
+  return const_iterator(root.next);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::const_iterator intrusive_list<T, Hook>::end()
+    const {
+  return const_iterator(const_cast<hook*>(&root));
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator
+intrusive_list<T, Hook>::iterator_to(reference value) {
+  return iterator(&(value.*Hook));
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+T& intrusive_list<T, Hook>::front() {
+  if (sz == 0) throw std::out_of_range("List is empty");
+  return *owner(root.next);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+T& intrusive_list<T, Hook>::back() {
+  if (sz == 0) throw std::out_of_range("List is empty");
+  return *owner(root.prev);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+bool intrusive_list<T, Hook>::empty() const {
+  return sz == 0;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+size_t intrusive_list<T, Hook>::size() const {
+  return sz;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+size_t intrusive_list<T, Hook>::max_size() const {
+  return std::numeric_limits<std::size_t>::max() / sizeof(T);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::clear() {
+  hook* it = root.next;
+  while (it != &root) {
+    hook* next = it->next;
+    it->next = it->prev = nullptr;
+    it = next;
+  }
+  root.next = root.prev = &root;
+  sz = 0;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::insert(
+    const_iterator pos, reference value) {
+  hook* h = &(value.*Hook);
+  if (h->is_linked()) throw std::logic_error("Element is already linked");
+  link_before(pos.ptr, h, h);
+  ++sz;
+  return iterator(h);
+}
+
+// pos must point into this list. A hook only knows its neighbours, not its
+// list, so erasing an element of another list unlinks it there but leaves
+// both sizes wrong; debug builds check membership, at O(n) per call.
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::erase(const_iterator pos) {
+  hook* h = pos.ptr;
+  assert(!h || h == &root || contains(h));
+  if (h && h != &root) {
+    unlink(h, h);
+    h->next = h->prev = nullptr;
+    --sz;
+  }
+}
+
+// Does nothing for an unlinked value; a linked one must be in this list.
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::erase(reference value) {
+  if ((value.*Hook).is_linked()) erase(iterator_to(value));
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::push_back(reference value) {
+  insert(end(), value);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::push_front(reference value) {
+  insert(begin(), value);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::pop_front() {
+  if (sz == 0) throw std::out_of_range("List is empty");
+  erase(begin());
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::pop_back() {
+  if (sz == 0) throw std::out_of_range("List is empty");
+  erase(iterator(root.prev));
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::swap(intrusive_list& other) {
+  if (this != &other) {
+    intrusive_list tmp(std::move(other));
+    other.take_root(*this);
+    take_root(tmp);
+  }
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos,
+                                     intrusive_list& other) {
+  if (this != &other && other.sz > 0) {
+    hook* first = other.root.next;
+    hook* last = other.root.prev;
+    unlink(first, last);
+    link_before(pos.ptr, first, last);
+    sz += other.sz;
+    other.sz = 0;
+  }
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos,
+                                     intrusive_list& other,
+                                     const_iterator it) {
+  hook* h = it.ptr;
+  if (h == &other.root || h == pos.ptr || h->next == pos.ptr) return;
+  unlink(h, h);
+  link_before(pos.ptr, h, h);
+  if (this != &other) {
+    --other.sz;
+    ++sz;
+  }
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos,
+                                     intrusive_list& other,
+                                     const_iterator first,
+                                     const_iterator last) {
+  if (first == last) return;
+  hook* last_hook = last.ptr->prev;
+  if (this != &other) {
+    size_type count = 1;
+    for (hook* it = first.ptr; it != last_hook; it = it->next) ++count;
+    other.sz -= count;
+    sz += count;
+  }
+  unlink(first.ptr, last_hook);
+  link_before(pos.ptr, first.ptr, last_hook);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::reverse() {
+  hook* it = &root;
+  do {
+    std::swap(it->next, it->prev);
+    it = it->prev;
+  } while (it != &root);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+std::ptrdiff_t intrusive_list<T, Hook>::offset() {
+  alignas(T) unsigned char probe[sizeof(T)];
+  T* obj = reinterpret_cast<T*>(probe);
+  return reinterpret_cast<unsigned char*>(&(obj->*Hook)) - probe;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+T* intrusive_list<T, Hook>::owner(hook* h) {
+  return reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(h) - offset());
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::unlink(hook* first, hook* last) {
+  first->prev->next = last->next;
+  last->next->prev = first->prev;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::link_before(hook* pos, hook* first,
+                                          hook* last) {
+  first->prev = pos->prev;
+  last->next = pos;
+  pos->prev->next = first;
+  pos->prev = last;
+}
+
+// The root hook lives inside the list object, so moving a chain means
+// re-pointing its two ends at the new root.
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::take_root(intrusive_list& other) {
+  if (other.sz > 0) {
+    root.next = other.root.next;
+    root.prev = other.root.prev;
+    root.next->prev = &root;
+    root.prev->next = &root;
+    other.root.next = other.root.prev = &other.root;
+  }
+  sz = other.sz;
+  other.sz = 0;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+bool intrusive_list<T, Hook>::contains(const hook* h) const {
+  for (const hook* it = root.next; it != &root; it = it->next)
+    if (it == h) return true;
+  return false;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::print() {
+  std::cout << "size: " << sz << '\n';
+  for (const T& el : *this) std::cout << el << ' ';
+  std::cout << "\n\n";
+}
+}  // namespace s21
+
+#endif
@@ -0,0 +1,296 @@
+#ifndef S21_MMAP_VECTOR_HPP
+#define S21_MMAP_VECTOR_HPP
+
+#include <fcntl.h>
+#include <stdbool.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+namespace s21 {
+template <typename T>
+class mmap_vector {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "mmap_vector stores raw bytes, T must be trivially copyable");
+
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = T*;
+  using const_iterator = const T*;
+  using size_type = size_t;
+
+  explicit mmap_vector(const std::string& path);
+  mmap_vector(const mmap_vector& v) = delete;
+  mmap_vector(mmap_vector&& v);
+  ~mmap_vector();
+  mmap_vector& operator=(mmap_vector&& v);
+
+  reference at(size_type pos);
+  reference operator[](size_type pos);
+  const_reference front();
+  const_reference back();
+  iterator data() const;
+
+  iterator begin() const;
+  iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void reserve(size_type size);
+  size_type capacity() const;
+  void shrink_to_fit();
+
+  void clear();
+  void push_back(const_reference value);
+  void pop_back();
+  void swap(mmap_vector& other);
+  void sync();
+
+  void print();
+
+ private:
+  // Lives at the start of the file; elements follow at offset header_bytes,
+  // so reopening only validates this block and maps the file.
+  struct header {
+    char magic[8];
+    std::uint64_t elem_size;
+    std::uint64_t size;
+  };
+  static constexpr size_type header_bytes = 64;
+  static constexpr char file_magic[8] = {'S', '2', '1', 'M',
+                                         'V', 'E', 'C', '1'};
+
+  int fd;
+  size_type cap;
+  unsigned char* base;
+
+  header* head() const;
+  void remap(size_type new_cap);
+  [[noreturn]] static void fail(const char* what);
+};
+
+template <typename T>
+mmap_vector<T>::mmap_vector(const std::string& path)
+    : fd(-1), cap(0), base(nullptr) {
+  fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+  if (fd < 0) fail("open");
+  struct stat st;
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    fail("fstat");
+  }
+  size_type file_size = st.st_size;
+  try {
+    if (file_size == 0) {
+      remap(0);
+      std::memcpy(head()->magic, file_magic, sizeof(file_magic));
+      head()->elem_size = sizeof(T);
+      head()->size = 0;
+    } else {
+      if (file_size < header_bytes ||
+          (file_size - header_bytes) % sizeof(T) != 0)
+        throw std::runtime_error("mmap_vector: incompatible file");
+      remap((file_size - header_bytes) / sizeof(T));
+      if (std::memcmp(head()->magic, file_magic, sizeof(file_magic)) != 0 ||
+          head()->elem_size != sizeof(T) || head()->size > cap)
+        throw std::runtime_error("mmap_vector: incompatible file");
+    }
+  } catch (...) {
+    if (base) ::munmap(base, header_bytes + cap * sizeof(T));
+    ::close(fd);
+    throw;
+  }
+}
+
+template <typename T>
+mmap_vector<T>::mmap_vector(mmap_vector&& v)
+    : fd(v.fd), cap(v.cap), base(v.base) {
+  v.fd = -1;
+  v.cap = 0;
+  v.base = nullptr;
+}
+
+template <typename T>
+mmap_vector<T>::~mmap_vector() {
+  if (base) ::munmap(base, header_bytes + cap * sizeof(T));
+  if (fd >= 0) ::close(fd);
+}
+
+template <typename T>
+mmap_vector<T>& mmap_vector<T>::operator=(mmap_vector&& v) {
+  if (this != &v) swap(v);
+  return *this;
+}
+
+template <typename T>
+T& mmap_vector<T>::at(size_t pos) {
+  if (pos >= size()) throw std::out_of_range("Index out range");
+  return *(data() + pos);
+}
+
+template <typename T>
+T& mmap_vector<T>::operator[](size_t pos) {
+  return *(data() + pos);
+}
+
+template <typename T>
+const T& mmap_vector<T>::front() {
+  return *data();
+}
+
+template <typename T>
+const T& mmap_vector<T>::back() {
+  return *(data() + size() - 1);
+}
+
+template <typename T>
+T* mmap_vector<T>::data() const {
+  return reinterpret_cast<T*>(base + header_bytes);
+}
+
+template <typename T>
+T* mmap_vector<T>::begin() const {
+  return data();
+}
+
+template <typename T>
+T* mmap_vector<T>::end() const {
+  return data() + size();
+}
+
+template <typename T>
+bool mmap_vector<T>::empty() const {
+  return (size() == 0);
+}
+
+template <typename T>
+size_t mmap_vector<T>::size() const {
+  return base ? head()->size : 0;
+}
+
+template <typename T>
+size_t mmap_vector<T>::max_size() const {
+  return (std::numeric_limits<off_t>::max() - header_bytes) / sizeof(T);
+}
+
+template <typename T>
+void mmap_vector<T>::reserve(size_t size) {
+  if (size > max_size())
+    throw std::length_error("Can't allocate memory of this size");
+  if (size > cap) remap(size);
+}
+
+template <typename T>
+size_t mmap_vector<T>::capacity() const {
+  return cap;
+}
+
+template <typename T>
+void mmap_vector<T>::shrink_to_fit() {
+  if (cap > size()) remap(size());
+}
+
+template <typename T>
+void mmap_vector<T>::clear() {
+  if (base) head()->size = 0;
+}
+
+template <typename T>
+void mmap_vector<T>::push_back(const T& value) {
+  size_type sz = size();
+  if (sz == cap) {
+    T tmp = value;
+    remap(2 * ((cap > 0) ? cap : 1));
+    std::memcpy(data() + sz, &tmp, sizeof(T));
+  } else {
+    std::memcpy(data() + sz, &value, sizeof(T));
+  }
+  head()->size = sz + 1;
+}
+
+template <typename T>
+void mmap_vector<T>::pop_back() {
+  if (base) --head()->size;
+}
+
+template <typename T>
+void mmap_vector<T>::swap(mmap_vector& other) {
+  std::swap(fd, other.fd);
+  std::swap(cap, other.cap);
+  std::swap(base, other.base);
+}
+
+template <typename T>
+void mmap_vector<T>::sync() {
+  if (::msync(base, header_bytes + cap * sizeof(T), MS_SYNC) != 0)
+    fail("msync");
+}
+
+template <typename T>
+void mmap_vector<T>::print() {
+  for (size_t i = 0; i < size(); ++i) std::cout << data()[i] << ' ';
+  std::cout << "\nsize: " << size() << "\ncapacity: " << cap << "\n\n";
+}
+
+template <typename T>
+typename mmap_vector<T>::header* mmap_vector<T>::head() const {
+  return reinterpret_cast<header*>(base);
+}
+
+// Resizes the file and the mapping together, keeping the file at least as
+// long as the mapping so that no mapped page lies past the end of the file.
+// A growing file is extended first and cut back if mapping fails; a
+// shrinking one is cut only after the smaller mapping is in place. The old
+// mapping is released only once the new one exists, so a failed mapping
+// leaves the vector untouched.
+template <typename T>
+void mmap_vector<T>::remap(size_t new_cap) {
+  size_type old_bytes = base ? header_bytes + cap * sizeof(T) : 0;
+  size_type new_bytes = header_bytes + new_cap * sizeof(T);
+  bool shrink = new_bytes < old_bytes;
+  if (!shrink && ::ftruncate(fd, new_bytes) != 0) fail("ftruncate");
+  void* mem = MAP_FAILED;
+#if defined(__linux__)
+  if (base) mem = ::mremap(base, old_bytes, new_bytes, MREMAP_MAYMOVE);
+#endif
+  if (mem == MAP_FAILED) {
+    mem = ::mmap(nullptr, new_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mem == MAP_FAILED) {
+      int error = errno;
+      // If cutting back fails too, a file longer than the mapping is
+      // harmless, so the mmap error is the one reported. glibc marks
+      // ftruncate warn_unused_result, which a (void) cast does not silence.
+      if (base && !shrink) {
+        [[maybe_unused]] int ignored = ::ftruncate(fd, old_bytes);
+      }
+      errno = error;
+      fail("mmap");
+    }
+    if (base) ::munmap(base, old_bytes);
+  }
+  base = static_cast<unsigned char*>(mem);
+  cap = new_cap;
+  if (shrink && ::ftruncate(fd, new_bytes) != 0) fail("ftruncate");
+}
+
+template <typename T>
+void mmap_vector<T>::fail(const char* what) {
+  throw std::system_error(errno, std::generic_category(),
+                          std::string("mmap_vector: ") + what);
+}
+}  // namespace s21
+
+#endif
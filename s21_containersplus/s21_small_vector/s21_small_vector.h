@@ -0,0 +1,427 @@
+#ifndef S21_SMALL_VECTOR_HPP
+#define S21_SMALL_VECTOR_HPP
+
+#include <stdbool.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../../s21_containers/s21_vector/s21_vector.h"
+
+namespace s21 {
+template <typename T, std::size_t N = 8>
+class small_vector {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = T*;
+  using const_iterator = const T*;
+  using size_type = size_t;
+
+  small_vector();
+  small_vector(size_type n);
+  small_vector(std::initializer_list<value_type> const& items);
+  small_vector(const small_vector& v);
+  small_vector(small_vector&& v);
+  ~small_vector();
+  small_vector& operator=(small_vector&& v);
+
+  reference at(size_type pos);
+  reference operator[](size_type pos);
+  const_reference front();
+  const_reference back();
+  iterator data() const;
+
+  iterator begin() const;
+  iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void reserve(size_type size);
+  size_type capacity() const;
+  void shrink_to_fit();
+  bool is_inline() const;
+  size_type allocations() const;
+
+  void clear();
+  iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type&& value);
+  void erase(iterator pos);
+  void push_back(const_reference value);
+  void push_back(value_type&& value);
+  void pop_back();
+  void swap(small_vector& other);
+
+  void print();
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args&&... args);
+
+  template <typename... Args>
+  void insert_many_back(Args&&... args);
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
+
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+
+ private:
+  alignas(T) unsigned char buffer[N * sizeof(T)];
+  size_type temp_size;
+  size_type cap;
+  value_type* mas;
+  size_type allocs;
+
+  static constexpr bool trivial = std::is_trivially_copyable<T>::value;
+
+  value_type* inline_data();
+
+  void release();
+  void steal(small_vector& v);
+  void reallocate(size_type new_cap);
+  template <typename Fill>
+  void realloc_gap(size_type pos, size_type count, Fill fill);
+};
+
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector()
+    : temp_size(0), cap(N), mas(inline_data()), allocs(0) {}
+
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector(size_t n) : small_vector() {
+  reserve(n);
+  for (; temp_size < n; ++temp_size) new (mas + temp_size) T();
+}
+
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector(std::initializer_list<T> const& items)
+    : small_vector() {
+  reserve(items.size());
+  for (const T& item : items) {
+    new (mas + temp_size) T(item);
+    ++temp_size;
+  }
+}
+
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector(const small_vector& v) : small_vector() {
+  reserve(v.temp_size);
+  if constexpr (trivial) {
+    if (v.temp_size > 0) std::memcpy(mas, v.mas, v.temp_size * sizeof(T));
+    temp_size = v.temp_size;
+  } else {
+    for (; temp_size < v.temp_size; ++temp_size)
+      new (mas + temp_size) T(v.mas[temp_size]);
+  }
+}
+
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector(small_vector&& v) : small_vector() {
+  steal(v);
+}
+
+template <typename T, std::size_t N>
+small_vector<T, N>::~small_vector() {
+  release();
+}
+
+template <typename T, std::size_t N>
+small_vector<T, N>& small_vector<T, N>::operator=(small_vector&& v) {
+  if (this != &v) {
+    release();
+    temp_size = 0;
+    cap = N;
+    mas = inline_data();
+    steal(v);
+  }
+  return *this;
+}
+
+template <typename T, std::size_t N>
+T& small_vector<T, N>::at(size_t pos) {
+  if (pos >= temp_size) throw std::out_of_range("Index out range");
+  return *(mas + pos);
+}
+
+template <typename T, std::size_t N>
+T& small_vector<T, N>::operator[](size_t pos) {
+  return *(mas + pos);
+}
+
+template <typename T, std::size_t N>
+const T& small_vector<T, N>::front() {
+  return *mas;
+}
+
+template <typename T, std::size_t N>
+const T& small_vector<T, N>::back() {
+  return *(mas + temp_size - 1);
+}
+
+template <typename T, std::size_t N>
+T* small_vector<T, N>::data() const {
+  return mas;
+}
+
+template <typename T, std::size_t N>
+T* small_vector<T, N>::begin() const {
+  return mas;
+}
+
+template <typename T, std::size_t N>
+T* small_vector<T, N>::end() const {
+  return mas + temp_size;
+}
+
+template <typename T, std::size_t N>
+bool small_vector<T, N>::empty() const {
+  return (temp_size == 0);
+}
+
+template <typename T, std::size_t N>
+size_t small_vector<T, N>::size() const {
+  return temp_size;
+}
+
+template <typename T, std::size_t N>
+size_t small_vector<T, N>::max_size() const {
+  return std::numeric_limits<std::size_t>::max() / (2 * sizeof(T));
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::reserve(size_t size) {
+  if (size > max_size())
+    throw std::length_error("Can't allocate memory of this size");
+  if (size > cap) reallocate(size);
+}
+
+template <typename T, std::size_t N>
+size_t small_vector<T, N>::capacity() const {
+  return cap;
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::shrink_to_fit() {
+  if (!is_inline() && cap > temp_size) reallocate(temp_size);
+}
+
+template <typename T, std::size_t N>
+bool small_vector<T, N>::is_inline() const {
+  return (mas == reinterpret_cast<const T*>(buffer));
+}
+
+template <typename T, std::size_t N>
+size_t small_vector<T, N>::allocations() const {
+  return allocs;
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::clear() {
+  release();
+  temp_size = 0;
+  cap = N;
+  mas = inline_data();
+}
+
+template <typename T, std::size_t N>
+T* small_vector<T, N>::insert(T* pos, const T& value) {
+  return emplace(pos, value);
+}
+
+template <typename T, std::size_t N>
+T* small_vector<T, N>::insert(T* pos, T&& value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::erase(T* pos) {
+  size_t pos_t = pos - begin();
+  if constexpr (trivial)
+    std::memmove(mas + pos_t, mas + pos_t + 1,
+                 (temp_size - pos_t - 1) * sizeof(T));
+  else
+    std::move(mas + pos_t + 1, mas + temp_size, mas + pos_t);
+  --temp_size;
+  mas[temp_size].~T();
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::push_back(const T& value) {
+  emplace_back(value);
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::push_back(T&& value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::pop_back() {
+  --temp_size;
+  mas[temp_size].~T();
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::swap(small_vector& other) {
+  if (this != &other) {
+    small_vector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::print() {
+  for (size_t i = 0; i < temp_size; ++i) std::cout << mas[i] << ' ';
+  std::cout << "\nsize: " << temp_size << "\ncapacity: " << cap << "\n\n";
+}
+
+template <typename T, std::size_t N>
+template <typename... Args>
+T* small_vector<T, N>::insert_many(const T* pos, Args&&... args) {
+  size_t pos_t = pos - begin();
+  size_t count = sizeof...(Args);
+  if (temp_size + count > cap) {
+    realloc_gap(pos_t, count, [&](T* dest) {
+      detail::construct_each(dest, std::forward<Args>(args)...);
+    });
+  } else {
+    detail::construct_each(mas + temp_size, std::forward<Args>(args)...);
+    temp_size += count;
+    std::rotate(mas + pos_t, mas + temp_size - count, mas + temp_size);
+  }
+  return (mas + pos_t + count);
+}
+
+template <typename T, std::size_t N>
+template <typename... Args>
+void small_vector<T, N>::insert_many_back(Args&&... args) {
+  insert_many(this->end(), std::forward<Args>(args)...);
+}
+
+template <typename T, std::size_t N>
+template <typename... Args>
+T* small_vector<T, N>::emplace(const T* pos, Args&&... args) {
+  size_t pos_t = pos - begin();
+  if (temp_size == cap) {
+    realloc_gap(pos_t, 1,
+                [&](T* dest) { new (dest) T(std::forward<Args>(args)...); });
+  } else if (pos_t == temp_size) {
+    new (mas + temp_size) T(std::forward<Args>(args)...);
+    ++temp_size;
+  } else {
+    T tmp(std::forward<Args>(args)...);
+    if constexpr (trivial) {
+      std::memmove(mas + pos_t + 1, mas + pos_t,
+                   (temp_size - pos_t) * sizeof(T));
+      ++temp_size;
+    } else {
+      new (mas + temp_size) T(std::move(mas[temp_size - 1]));
+      ++temp_size;
+      std::move_backward(mas + pos_t, mas + temp_size - 2,
+                         mas + temp_size - 1);
+    }
+    mas[pos_t] = std::move(tmp);
+  }
+  return (mas + pos_t);
+}
+
+template <typename T, std::size_t N>
+template <typename... Args>
+T& small_vector<T, N>::emplace_back(Args&&... args) {
+  if (temp_size == cap) {
+    realloc_gap(temp_size, 1,
+                [&](T* dest) { new (dest) T(std::forward<Args>(args)...); });
+  } else {
+    new (mas + temp_size) T(std::forward<Args>(args)...);
+    ++temp_size;
+  }
+  return mas[temp_size - 1];
+}
+
+template <typename T, std::size_t N>
+T* small_vector<T, N>::inline_data() {
+  return reinterpret_cast<T*>(buffer);
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::release() {
+  detail::destroy_range(mas, mas + temp_size);
+  if (!is_inline()) ::operator delete(mas);
+}
+
+// Takes over a heap buffer, or moves inline elements one by one.
+template <typename T, std::size_t N>
+void small_vector<T, N>::steal(small_vector& v) {
+  if (v.is_inline()) {
+    detail::relocate_range(v.mas, v.mas + v.temp_size, mas);
+    temp_size = v.temp_size;
+    v.clear();
+  } else {
+    mas = v.mas;
+    cap = v.cap;
+    temp_size = v.temp_size;
+    v.temp_size = 0;
+    v.cap = N;
+    v.mas = v.inline_data();
+  }
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::reallocate(size_t new_cap) {
+  bool to_inline = new_cap <= N;
+  T* new_mas = to_inline ? inline_data()
+                         : static_cast<T*>(::operator new(new_cap * sizeof(T)));
+  if (new_mas == mas) return;
+  try {
+    detail::relocate_range(mas, mas + temp_size, new_mas);
+  } catch (...) {
+    if (!to_inline) ::operator delete(new_mas);
+    throw;
+  }
+  release();
+  mas = new_mas;
+  cap = to_inline ? N : new_cap;
+  if (!to_inline) ++allocs;
+}
+
+template <typename T, std::size_t N>
+template <typename Fill>
+void small_vector<T, N>::realloc_gap(size_t pos, size_t count, Fill fill) {
+  size_t new_cap = std::max(2 * ((cap > 0) ? cap : 1), temp_size + count);
+  T* new_mas = static_cast<T*>(::operator new(new_cap * sizeof(T)));
+  bool placed = false;
+  try {
+    fill(new_mas + pos);
+    placed = true;
+    detail::relocate_range(mas, mas + pos, new_mas);
+    try {
+      detail::relocate_range(mas + pos, mas + temp_size,
+                             new_mas + pos + count);
+    } catch (...) {
+      detail::destroy_range(new_mas, new_mas + pos);
+      throw;
+    }
+  } catch (...) {
+    if (placed) detail::destroy_range(new_mas + pos, new_mas + pos + count);
+    ::operator delete(new_mas);
+    throw;
+  }
+  release();
+  mas = new_mas;
+  cap = new_cap;
+  temp_size += count;
+  ++allocs;
+}
+}  // namespace s21
+
+#endif
@@ -0,0 +1,612 @@
+#ifndef S21_UNROLLED_LIST_HPP
+#define S21_UNROLLED_LIST_HPP
+
+#include <stdbool.h>
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../../s21_containers/s21_vector/s21_vector.h"
+
+namespace s21 {
+// Doubly linked list of blocks, each holding up to block_capacity elements
+// in a cache-line-sized array. The array is aligned to a cache line, so the
+// links sit on a line of their own and a default block's elements never
+// straddle two lines. A full block is split in half on insert and
+// an underfilled block is merged with its successor on erase. Inserting or
+// erasing invalidates iterators into the affected blocks.
+template <typename T, std::size_t BlockBytes = 64>
+class unrolled_list {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  static constexpr size_type block_capacity =
+      BlockBytes / sizeof(T) > 1 ? BlockBytes / sizeof(T) : 1;
+
+ private:
+  struct link {
+    link* next;
+    link* prev;
+    size_type count;
+  };
+
+  static constexpr size_type cache_line = 64;
+
+  struct block : link {
+    alignas(alignof(T) > cache_line ? alignof(T) : cache_line) unsigned char
+        storage[block_capacity * sizeof(T)];
+  };
+
+  static T* items(link* b) {
+    return reinterpret_cast<T*>(static_cast<block*>(b)->storage);
+  }
+
+ public:
+  class const_iterator {
+   public:
+    const_iterator() : ptr(nullptr), index(0) {}
+    const_iterator(link* b, size_type i) : ptr(b), index(i) {}
+
+    bool operator!=(const const_iterator& other) const {
+      return ptr != other.ptr || index != other.index;
+    }
+    bool operator==(const const_iterator& other) const {
+      return !(*this != other);
+    }
+    const_reference operator*() const { return items(ptr)[index]; }
+
+    const_iterator operator++(int) {
+      const_iterator tmp(*this);
+      increment();
+      return tmp;
+    }
+
+    const_iterator& operator++() {
+      increment();
+      return *this;
+    }
+
+    const_iterator operator--(int) {
+      const_iterator tmp(*this);
+      decrement();
+      return tmp;
+    }
+
+    const_iterator& operator--() {
+      decrement();
+      return *this;
+    }
+
+   protected:
+    link* ptr;
+    size_type index;
+
+    void increment() {
+      if (++index >= ptr->count) {
+        ptr = ptr->next;
+        index = 0;
+      }
+    }
+
+    void decrement() {
+      if (index > 0) {
+        --index;
+      } else {
+        ptr = ptr->prev;
+        index = ptr->count ? ptr->count - 1 : 0;
+      }
+    }
+
+    friend class unrolled_list;
+  };
+
+  class iterator : public const_iterator {
+   public:
+    iterator() : const_iterator() {}
+    iterator(link* b, size_type i) : const_iterator(b, i) {}
+
+    reference operator*() const { return items(this->ptr)[this->index]; }
+    friend class unrolled_list;
+  };
+
+  unrolled_list();
+  unrolled_list(size_type n);
+  unrolled_list(std::initializer_list<value_type> const& items);
+  unrolled_list(const unrolled_list& other);
+  unrolled_list(unrolled_list&& other);
+  ~unrolled_list();
+
+  unrolled_list& operator=(const unrolled_list& other);
+  unrolled_list& operator=(unrolled_list&& other);
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  const_reference front() const;
+  const_reference back() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  size_type blocks() const;
+
+  void clear();
+  iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, value_type&& value);
+  void erase(const_iterator pos);
+  void push_back(const_reference data);
+  void push_front(const_reference data);
+  void pop_front();
+  void pop_back();
+  void swap(unrolled_list& other);
+  void merge(unrolled_list& other);
+  template <typename Compare>
+  void merge(unrolled_list& other, Compare comp);
+  void splice(const_iterator pos, unrolled_list& other);
+  void reverse();
+  void unique();
+  void sort();
+  template <typename Compare>
+  void sort(Compare comp);
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args&&... args);
+
+  template <typename... Args>
+  void insert_many_back(Args&&... args);
+
+  template <typename... Args>
+  void insert_many_front(Args&&... args);
+
+  void print();
+
+ private:
+  link* stub;
+  size_type sz;
+  size_type block_count;
+
+  link* create_block(link* before);
+  void destroy_block(link* b);
+  static void move_items(T* first, T* last, T* dest);
+  link* split(link* b, size_type at);
+  void rebalance(link* b);
+  void drain(vector<T>& out);
+  void refill(vector<T>& in);
+};
+
+template <typename T, std::size_t BlockBytes>
+unrolled_list<T, BlockBytes>::unrolled_list()
+    : stub(new link{nullptr, nullptr, 0}), sz(0), block_count(0) {
+  stub->next = stub->prev = stub;
+}
+
+template <typename T, std::size_t BlockBytes>
+unrolled_list<T, BlockBytes>::unrolled_list(size_t n) : unrolled_list() {
+  while (n-- > 0) emplace(end());
+}
+
+template <typename T, std::size_t BlockBytes>
+unrolled_list<T, BlockBytes>::unrolled_list(
+    std::initializer_list<T> const& items)
+    : unrolled_list() {
+  for (const T& el : items) push_back(el);
+}
+
+template <typename T, std::size_t BlockBytes>
+unrolled_list<T, BlockBytes>::unrolled_list(const unrolled_list& other)
+    : unrolled_list() {
+  for (const T& el : other) push_back(el);
+}
+
+template <typename T, std::size_t BlockBytes>
+unrolled_list<T, BlockBytes>::unrolled_list(unrolled_list&& other)
+    : unrolled_list() {
+  swap(other);
+}
+
+template <typename T, std::size_t BlockBytes>
+unrolled_list<T, BlockBytes>::~unrolled_list() {
+  clear();
+  delete stub;
+}
+
+template <typename T, std::size_t BlockBytes>
+unrolled_list<T, BlockBytes>& unrolled_list<T, BlockBytes>::operator=(
+    const unrolled_list& other) {
+  if (this != &other) {
+    unrolled_list tmp(other);
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename T, std::size_t BlockBytes>
+unrolled_list<T, BlockBytes>& unrolled_list<T, BlockBytes>::operator=(
+    unrolled_list&& other) {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::iterator
+unrolled_list<T, BlockBytes>::begin() {
+  return iterator(stub->next, 0);
+}
+
+template <typename T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::iterator
+unrolled_list<T, BlockBytes>::end() {
+  return iterator(stub, 0);
+}
+
+template <typename T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::const_iterator
+unrolled_list<T, BlockBytes>::begin() const {
+  return const_iterator(stub->next, 0);
+}
+
+template <typename T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::const_iterator
+unrolled_list<T, BlockBytes>::end() const {
+  return const_iterator(stub, 0);
+}
+
+template <typename T, std::size_t BlockBytes>
+const T& unrolled_list<T, BlockBytes>::front() const {
+  if (sz == 0) throw std::out_of_range("List is empty");
+  return items(stub->next)[0];
+}
+
+template <typename T, std::size_t BlockBytes>
+const T& unrolled_list<T, BlockBytes>::back() const {
+  if (sz == 0) throw std::out_of_range("List is empty");
+  return items(stub->prev)[stub->prev->count - 1];
+}
+
+template <typename T, std::size_t BlockBytes>
+bool unrolled_list<T, BlockBytes>::empty() const {
+  return sz == 0;
+}
+
+template <typename T, std::size_t BlockBytes>
+size_t unrolled_list<T, BlockBytes>::size() const {
+  return sz;
+}
+
+template <typename T, std::size_t BlockBytes>
+size_t unrolled_list<T, BlockBytes>::max_size() const {
+  return std::numeric_limits<std::size_t>::max() / sizeof(T) / 2;
+}
+
+template <typename T, std::size_t BlockBytes>
+size_t unrolled_list<T, BlockBytes>::blocks() const {
+  return block_count;
+}
+
+template <typename T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::clear() {
+  while (stub->next != stub) destroy_block(stub->next);
+  sz = 0;
+}
+
+template <typename T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::iterator
+unrolled_list<T, BlockBytes>::insert(const_iterator pos,
+                                     const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::iterator
+unrolled_list<T, BlockBytes>::insert(const_iterator pos, value_type&& value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename T, std::size_t BlockBytes>
+template <typename... Args>
+typename unrolled_list<T, BlockBytes>::iterator
+unrolled_list<T, BlockBytes>::emplace(const_iterator pos, Args&&... args) {
+  link* b = pos.ptr;
+  size_type i = pos.index;
+  if (i == 0 && b->prev != stub && b->prev->count < block_capacity) {
+    b = b->prev;
+    i = b->count;
+  } else if (b == stub) {
+    b = create_block(stub);
+  } else if (b->count == block_capacity) {
+    size_type half = block_capacity / 2;
+    link* upper = split(b, half);
+    if (i > half) {
+      b = upper;
+      i -= half;
+    }
+  }
+  T* data = items(b);
+  if (i == b->count) {
+    new (data + i) T(std::forward<Args>(args)...);
+  } else {
+    T tmp(std::forward<Args>(args)...);
+    new (data + b->count) T(std::move(data[b->count - 1]));
+    std::move_backward(data + i, data + b->count - 1, data + b->count);
+    data[i] = std::move(tmp);
+  }
+  ++b->count;
+  ++sz;
+  return iterator(b, i);
+}
+
+template <typename T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::erase(const_iterator pos) {
+  link* b = pos.ptr;
+  if (b == stub || pos.index >= b->count) return;
+  T* data = items(b);
+  std::move(data + pos.index + 1, data + b->count, data + pos.index);
+  data[--b->count].~T();
+  --sz;
+  rebalance(b);
+}
+
+template <typename T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::push_back(const_reference data) {
+  emplace(end(), data);
+}
+
+template <typename T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::push_front(const_reference data) {
+  emplace(begin(), data);
+}
+
+template <typename T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::pop_front() {
+  if (sz == 0) throw std::out_of_range("List is empty");
+  erase(begin());
+}
+
+template <typename T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::pop_back() {
+  if (sz == 0) throw std::out_of_range("List is empty");
+  erase(const_iterator(stub->prev, stub->prev->count - 1));
+}
+
+template <typename T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::swap(unrolled_list& other) {
+  std::swap(stub, other.stub);
+  std::swap(sz, other.sz);
+  std::swap(block_count, other.block_count);
+}
+
+template <typename T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::merge(unrolled_list& other) {
+  merge(other, std::less<T>());
+}
+
+template <typename T, std::size_t BlockBytes>
+template <typename Compare>
+void unrolled_list<T, BlockBytes>::merge(unrolled_list& other,
+                                         Compare comp) {
+  if (this != &other && other.sz > 0) {
+    size_type mid = sz;
+    vector<T> buf;
+    buf.reserve(sz + other.sz);
+    drain(buf);
+    other.drain(buf);
+    other.clear();
+    std::inplace_merge(buf.begin(), buf.begin() + mid, buf.end(), comp);
+    refill(buf);
+  }
+}
+
+// Splits the block holding pos so that other's blocks can be linked in
+// whole; no element of other is moved.
+template <typename T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::splice(const_iterator pos,
+                                          unrolled_list& other) {
+  if (this != &other && other.sz > 0) {
+    link* b = pos.ptr;
+    if (pos.index > 0) b = split(b, pos.index);
+    link* first = other.stub->next;
+    link* last = other.stub->prev;
+    other.stub->next = other.stub->prev = other.stub;
+    first->prev = b->prev;
+    b->prev->next = first;
+    last->next = b;
+    b->prev = last;
+    sz += other.sz;
+    block_count += other.block_count;
+    other.sz = 0;
+    other.block_count = 0;
+    rebalance(last);
+  }
+}
+
+template <typename T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::reverse() {
+  link* b = stub;
+  do {
+    std::swap(b->next, b->prev);
+    if (b != stub) std::reverse(items(b), items(b) + b->count);
+    b = b->prev;
+  } while (b != stub);
+}
+
+template <typename T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::unique() {
+  T* last = nullptr;
+  for (link* b = stub->next; b != stub;) {
+    T* data = items(b);
+    size_type kept = 0;
+    for (size_type i = 0; i < b->count; ++i) {
+      if (last && data[i] == *last) {
+        data[i].~T();
+        --sz;
+      } else {
+        if (kept != i) {
+          new (data + kept) T(std::move(data[i]));
+          data[i].~T();
+        }
+        last = data + kept++;
+      }
+    }
+    b->count = kept;
+    link* next = b->next;
+    if (kept == 0) destroy_block(b);
+    b = next;
+  }
+}
+
+template <typename T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::sort() {
+  sort(std::less<T>());
+}
+
+// Elements are moved out into one contiguous buffer, sorted there and moved
+// back into the existing blocks, which end up full.
+template <typename T, std::size_t BlockBytes>
+template <typename Compare>
+void unrolled_list<T, BlockBytes>::sort(Compare comp) {
+  if (sz > 1) {
+    vector<T> buf;
+    buf.reserve(sz);
+    drain(buf);
+    std::stable_sort(buf.begin(), buf.end(), comp);
+    refill(buf);
+  }
+}
+
+template <typename T, std::size_t BlockBytes>
+template <typename... Args>
+typename unrolled_list<T, BlockBytes>::iterator
+unrolled_list<T, BlockBytes>::insert_many(const_iterator pos,
+                                          Args&&... args) {
+  iterator it(pos.ptr, pos.index);
+  ((it = emplace(it, std::forward<Args>(args)), ++it), ...);
+  return it;
+}
+
+template <typename T, std::size_t BlockBytes>
+template <typename... Args>
+void unrolled_list<T, BlockBytes>::insert_many_back(Args&&... args) {
+  (emplace(end(), std::forward<Args>(args)), ...);
+}
+
+template <typename T, std::size_t BlockBytes>
+template <typename... Args>
+void unrolled_list<T, BlockBytes>::insert_many_front(Args&&... args) {
+  insert_many(begin(), std::forward<Args>(args)...);
+}
+
+template <typename T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::link*
+unrolled_list<T, BlockBytes>::create_block(link* before) {
+  link* b = new block;
+  b->count = 0;
+  b->next = before;
+  b->prev = before->prev;
+  before->prev->next = b;
+  before->prev = b;
+  ++block_count;
+  return b;
+}
+
+template <typename T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::destroy_block(link* b) {
+  if (!std::is_trivially_destructible<T>::value)
+    for (size_type i = 0; i < b->count; ++i) items(b)[i].~T();
+  sz -= b->count;
+  b->prev->next = b->next;
+  b->next->prev = b->prev;
+  delete static_cast<block*>(b);
+  --block_count;
+}
+
+template <typename T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::move_items(T* first, T* last, T* dest) {
+  for (; first != last; ++first, ++dest) {
+    new (dest) T(std::move(*first));
+    first->~T();
+  }
+}
+
+// Moves the elements from position at onwards into a new block linked after
+// b and returns that block.
+template <typename T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::link*
+unrolled_list<T, BlockBytes>::split(link* b, size_type at) {
+  link* upper = create_block(b->next);
+  move_items(items(b) + at, items(b) + b->count, items(upper));
+  upper->count = b->count - at;
+  b->count = at;
+  return upper;
+}
+
+template <typename T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::rebalance(link* b) {
+  if (b->count == 0) {
+    destroy_block(b);
+  } else if (b->count < block_capacity / 2 && b->next != stub &&
+             b->count + b->next->count <= block_capacity) {
+    link* next = b->next;
+    move_items(items(next), items(next) + next->count, items(b) + b->count);
+    b->count += next->count;
+    next->count = 0;
+    destroy_block(next);
+  }
+}
+
+template <typename T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::drain(vector<T>& out) {
+  for (link* b = stub->next; b != stub; b = b->next) {
+    for (size_type i = 0; i < b->count; ++i) {
+      out.push_back(std::move(items(b)[i]));
+      items(b)[i].~T();
+    }
+    sz -= b->count;
+    b->count = 0;
+  }
+}
+
+template <typename T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::refill(vector<T>& in) {
+  size_type i = 0;
+  link* b = stub->next;
+  while (i < in.size()) {
+    if (b == stub) b = create_block(stub);
+    size_type n = std::min(block_capacity, in.size() - i);
+    for (size_type k = 0; k < n; ++k) new (items(b) + k) T(std::move(in[i++]));
+    b->count = n;
+    sz += n;
+    b = b->next;
+  }
+  while (b != stub) {
+    link* next = b->next;
+    destroy_block(b);
+    b = next;
+  }
+}
+
+template <typename T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::print() {
+  std::cout << "size: " << sz << '\n';
+  for (const T& el : *this) std::cout << el << ' ';
+  std::cout << "\n\n";
+}
+}  // namespace s21
+
+#endif
@@ -1,4 +1,5 @@
 #include <array>
+#include <string>
 
 #include "s21_main_test.h"
 
@@ -119,3 +120,9 @@ TEST(Array, MethodFill) {
   b.fill(10);
   compare_arrays(a, b);
 }
+
+TEST(Array, ConstructorCopyNonTrivial) {
+  s21::array<std::string, 3> a{"a", "b", "c"};
+  s21::array<std::string, 3> b(a);
+  for (size_t i = 0; i < 3; ++i) EXPECT_EQ(a[i], b[i]);
+}
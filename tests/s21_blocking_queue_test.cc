@@ -0,0 +1,149 @@
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_main_test.h"
+
+TEST(BlockingQueue, PushPop) {
+  s21::blocking_queue<std::string> a;
+  EXPECT_EQ(a.capacity(), 0UL);
+  EXPECT_TRUE(a.empty());
+  std::string out;
+  EXPECT_FALSE(a.try_pop(out));
+  EXPECT_TRUE(a.push("a"));
+  std::string b = "b";
+  EXPECT_TRUE(a.try_push(b));
+  EXPECT_TRUE(a.emplace(2, 'c'));
+  EXPECT_EQ(a.size(), 3UL);
+  EXPECT_TRUE(a.pop_wait(out));
+  EXPECT_EQ(out, "a");
+  EXPECT_TRUE(a.try_pop(out));
+  EXPECT_EQ(out, "b");
+  EXPECT_TRUE(a.pop_wait_for(out, std::chrono::milliseconds(1)));
+  EXPECT_EQ(out, "cc");
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(BlockingQueue, Timeout) {
+  s21::blocking_queue<int> a;
+  int out = 7;
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_FALSE(a.pop_wait_for(out, std::chrono::milliseconds(20)));
+  EXPECT_GE(std::chrono::steady_clock::now() - start,
+            std::chrono::milliseconds(20));
+  EXPECT_EQ(out, 7);
+}
+
+TEST(BlockingQueue, Capacity) {
+  s21::blocking_queue<int> a(2);
+  EXPECT_TRUE(a.try_push(1));
+  EXPECT_TRUE(a.push(2));
+  EXPECT_FALSE(a.try_push(3));
+  std::thread producer([&a] { EXPECT_TRUE(a.push(3)); });
+  int out;
+  EXPECT_TRUE(a.pop_wait(out));
+  EXPECT_EQ(out, 1);
+  producer.join();
+  EXPECT_EQ(a.size(), 2UL);
+}
+
+TEST(BlockingQueue, Close) {
+  s21::blocking_queue<std::unique_ptr<int>> a;
+  a.push(std::make_unique<int>(1));
+  a.close();
+  EXPECT_TRUE(a.closed());
+  EXPECT_FALSE(a.push(std::make_unique<int>(2)));
+  std::unique_ptr<int> out;
+  EXPECT_TRUE(a.pop_wait(out));
+  EXPECT_EQ(*out, 1);
+  EXPECT_FALSE(a.pop_wait(out));
+  EXPECT_FALSE(a.pop_wait_for(out, std::chrono::seconds(10)));
+}
+
+TEST(BlockingQueue, CloseWakesWaiters) {
+  s21::blocking_queue<int> a(1);
+  a.push(0);
+  std::thread producer([&a] { EXPECT_FALSE(a.push(1)); });
+  s21::blocking_queue<int> b;
+  std::thread waiter([&b] {
+    int out;
+    EXPECT_FALSE(b.pop_wait(out));
+  });
+  a.close();
+  b.close();
+  producer.join();
+  waiter.join();
+}
+
+TEST(BlockingQueue, PopBulk) {
+  s21::blocking_queue<int> a;
+  for (int i = 0; i < 10; ++i) a.push(i);
+  std::vector<int> out;
+  EXPECT_EQ(a.pop_bulk(std::back_inserter(out), 4), 4UL);
+  EXPECT_EQ(a.pop_bulk(std::back_inserter(out), 100), 6UL);
+  EXPECT_EQ(out, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+  EXPECT_EQ(a.pop_bulk(std::back_inserter(out), 0), 0UL);
+  a.close();
+  EXPECT_EQ(a.pop_bulk(std::back_inserter(out), 4), 0UL);
+}
+
+struct FailingSink {
+  int* left;
+
+  FailingSink& operator*() { return *this; }
+  FailingSink& operator++() { return *this; }
+  FailingSink& operator=(int) {
+    if ((*left)-- == 0) throw std::runtime_error("sink");
+    return *this;
+  }
+};
+
+TEST(BlockingQueue, PopBulkThrowWakesProducers) {
+  s21::blocking_queue<int> a(2);
+  a.push(1);
+  a.push(2);
+  std::thread producer([&a] { EXPECT_TRUE(a.push(3)); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  int left = 1;
+  EXPECT_THROW(a.pop_bulk(FailingSink{&left}, 2), std::runtime_error);
+  producer.join();
+  EXPECT_EQ(a.size(), 2UL);
+  int out;
+  EXPECT_TRUE(a.try_pop(out));
+  EXPECT_EQ(out, 2);
+}
+
+TEST(BlockingQueue, ManyThreads) {
+  const int producers = 4;
+  const int per_producer = 10000;
+  s21::blocking_queue<int> a(64);
+  std::vector<std::thread> threads;
+  std::vector<long long> sums(3, 0);
+  for (int p = 0; p < producers; ++p)
+    threads.emplace_back([&a, p] {
+      for (int i = 0; i < per_producer; ++i) a.push(p * per_producer + i);
+    });
+  threads.emplace_back([&a, &sums] {
+    int out;
+    while (a.pop_wait(out)) sums[0] += out;
+  });
+  threads.emplace_back([&a, &sums] {
+    int out[16];
+    while (size_t got = a.pop_bulk(out, 16))
+      for (size_t i = 0; i < got; ++i) sums[1] += out[i];
+  });
+  threads.emplace_back([&a, &sums] {
+    int out;
+    while (!a.closed() || !a.empty())
+      if (a.pop_wait_for(out, std::chrono::milliseconds(1))) sums[2] += out;
+  });
+  for (int p = 0; p < producers; ++p) threads[p].join();
+  a.close();
+  for (size_t t = producers; t < threads.size(); ++t) threads[t].join();
+  long long n = producers * per_producer;
+  EXPECT_EQ(sums[0] + sums[1] + sums[2], n * (n - 1) / 2);
+}
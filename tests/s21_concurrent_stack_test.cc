@@ -0,0 +1,99 @@
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_main_test.h"
+
+namespace {
+struct Counted {
+  static int alive;
+  int value;
+
+  explicit Counted(int v = 0) : value(v) { ++alive; }
+  Counted(const Counted& other) : value(other.value) { ++alive; }
+  Counted& operator=(const Counted& other) = default;
+  ~Counted() { --alive; }
+};
+
+int Counted::alive = 0;
+}  // namespace
+
+TEST(ConcurrentStack, PushPop) {
+  s21::concurrent_stack<std::string> a;
+  std::string out;
+  EXPECT_TRUE(a.empty());
+  EXPECT_FALSE(a.try_pop(out));
+  a.push("a");
+  std::string b = "b";
+  a.push(b);
+  a.emplace(2, 'c');
+  EXPECT_FALSE(a.empty());
+  EXPECT_TRUE(a.try_pop(out));
+  EXPECT_EQ(out, "cc");
+  EXPECT_TRUE(a.try_pop(out));
+  EXPECT_EQ(out, "b");
+  EXPECT_TRUE(a.try_pop(out));
+  EXPECT_EQ(out, "a");
+  EXPECT_FALSE(a.try_pop(out));
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(ConcurrentStack, MoveOnly) {
+  s21::concurrent_stack<std::unique_ptr<int>> a;
+  a.push(std::make_unique<int>(1));
+  a.emplace(new int(2));
+  std::unique_ptr<int> out;
+  EXPECT_TRUE(a.try_pop(out));
+  EXPECT_EQ(*out, 2);
+  EXPECT_TRUE(a.try_pop(out));
+  EXPECT_EQ(*out, 1);
+}
+
+TEST(ConcurrentStack, DestroysRemaining) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::concurrent_stack<std::shared_ptr<int>> a;
+    a.push(counter);
+    a.push(counter);
+    EXPECT_EQ(counter.use_count(), 3);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(ConcurrentStack, ReclaimsPoppedNodes) {
+  s21::concurrent_stack<Counted> a;
+  Counted out;
+  int before = Counted::alive;
+  for (int i = 0; i < 1000; ++i) {
+    a.emplace(i);
+    EXPECT_TRUE(a.try_pop(out));
+    EXPECT_EQ(out.value, i);
+  }
+  EXPECT_LT(Counted::alive - before, 100);
+}
+
+TEST(ConcurrentStack, Stress) {
+  const int threads = 8;
+  const int per_thread = 20000;
+  s21::concurrent_stack<int> a;
+  std::vector<long long> sums(threads, 0);
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t)
+    workers.emplace_back([&a, &sums, t] {
+      int out;
+      for (int i = 0; i < per_thread; ++i) {
+        a.push(t * per_thread + i);
+        if (i % 2 && a.try_pop(out)) sums[t] += out;
+      }
+      while (a.try_pop(out)) sums[t] += out;
+    });
+  for (auto& w : workers) w.join();
+  int out;
+  long long total = 0;
+  while (a.try_pop(out)) total += out;
+  for (long long s : sums) total += s;
+  long long n = static_cast<long long>(threads) * per_thread;
+  EXPECT_EQ(total, n * (n - 1) / 2);
+  EXPECT_TRUE(a.empty());
+}
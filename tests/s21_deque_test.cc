@@ -0,0 +1,138 @@
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <string>
+
+#include "s21_main_test.h"
+
+template <typename T>
+void compare_deques(const std::deque<T>& std_deque,
+                    const s21::deque<T>& s21_deque) {
+  EXPECT_EQ(std_deque.size(), s21_deque.size());
+  if (std_deque.size() == s21_deque.size()) {
+    for (size_t i = 0; i < std_deque.size(); ++i)
+      EXPECT_EQ(std_deque[i], s21_deque[i]);
+  }
+}
+
+TEST(Deque, ConstructorDefault) {
+  s21::deque<int> a;
+  EXPECT_EQ(a.size(), 0UL);
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.begin(), a.end());
+  EXPECT_EQ(a.allocations(), 0UL);
+}
+
+TEST(Deque, ConstructorParameterized) {
+  std::deque<int> a(3000);
+  s21::deque<int> b(3000);
+  compare_deques(a, b);
+}
+
+TEST(Deque, ConstructorCopyMove) {
+  std::deque<std::string> a{"a", "b", "c"};
+  s21::deque<std::string> b{"a", "b", "c"};
+  s21::deque<std::string> c(b);
+  s21::deque<std::string> d(std::move(b));
+  EXPECT_TRUE(b.empty());
+  compare_deques(a, c);
+  compare_deques(a, d);
+  b = c;
+  c = std::move(d);
+  compare_deques(a, b);
+  compare_deques(a, c);
+}
+
+TEST(Deque, ChunkSize) {
+  EXPECT_EQ(s21::deque<int>::chunk_size, 1024UL);
+  EXPECT_EQ(s21::deque<char>::chunk_size, 4096UL);
+  EXPECT_EQ(s21::deque<std::string>::chunk_size, 128UL);
+}
+
+TEST(Deque, PushPopBothEnds) {
+  std::deque<int> a;
+  s21::deque<int> b;
+  for (int i = 0; i < 10000; ++i) {
+    if (i % 3) {
+      a.push_back(i);
+      b.push_back(i);
+    } else {
+      a.push_front(i);
+      b.push_front(i);
+    }
+  }
+  compare_deques(a, b);
+  EXPECT_EQ(a.front(), b.front());
+  EXPECT_EQ(a.back(), b.back());
+  for (int i = 0; i < 4000; ++i) {
+    a.pop_front();
+    b.pop_front();
+    a.pop_back();
+    b.pop_back();
+  }
+  compare_deques(a, b);
+  b.clear();
+  EXPECT_TRUE(b.empty());
+  b.pop_back();
+  b.pop_front();
+  b.push_front(1);
+  EXPECT_EQ(b.back(), 1);
+}
+
+TEST(Deque, At) {
+  s21::deque<int> a{1, 2, 3};
+  EXPECT_EQ(a.at(2), 3);
+  a.at(1) = 7;
+  EXPECT_EQ(a[1], 7);
+  EXPECT_THROW(a.at(3), std::out_of_range);
+  s21::deque<int> b;
+  EXPECT_THROW(b.front(), std::out_of_range);
+  EXPECT_THROW(b.back(), std::out_of_range);
+}
+
+TEST(Deque, RandomAccessIterator) {
+  s21::deque<int> a;
+  for (int i = 0; i < 5000; ++i) a.push_front(i);
+  EXPECT_EQ(a.end() - a.begin(), 5000);
+  EXPECT_EQ(*(a.begin() + 4999), 0);
+  EXPECT_EQ(a.begin()[10], 4989);
+  std::sort(a.begin(), a.end());
+  EXPECT_TRUE(std::is_sorted(a.begin(), a.end()));
+  EXPECT_EQ(a.front(), 0);
+  s21::deque<int>::const_iterator it = a.begin();
+  it += 100;
+  EXPECT_EQ(*it, 100);
+  EXPECT_TRUE(a.begin() < it);
+}
+
+TEST(Deque, RecyclesChunks) {
+  s21::deque<int> a;
+  for (int round = 0; round < 100; ++round) {
+    for (int i = 0; i < 3000; ++i) a.push_back(i);
+    for (int i = 0; i < 3000; ++i) {
+      EXPECT_EQ(a.front(), i);
+      a.pop_front();
+    }
+  }
+  EXPECT_LE(a.allocations(), 5UL);
+  a.shrink_to_fit();
+  a.push_back(1);
+  EXPECT_EQ(a.size(), 1UL);
+}
+
+TEST(Deque, InsertMany) {
+  std::deque<int> a{1, 2, 3, 4, 5, 6, 7};
+  s21::deque<int> b{4};
+  b.insert_many_back(5, 6, 7);
+  b.insert_many_front(1, 2, 3);
+  compare_deques(a, b);
+}
+
+TEST(Deque, MoveOnly) {
+  s21::deque<std::unique_ptr<int>> a;
+  a.push_back(std::make_unique<int>(2));
+  a.emplace_front(new int(1));
+  a.push_front(std::make_unique<int>(0));
+  EXPECT_EQ(*a.emplace_back(new int(3)), 3);
+  for (int i = 0; i < 4; ++i) EXPECT_EQ(*a[i], i);
+}
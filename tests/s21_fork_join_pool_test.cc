@@ -0,0 +1,72 @@
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+
+#include "s21_main_test.h"
+
+namespace {
+long Fib(s21::fork_join_pool& pool, int n) {
+  if (n < 2) return n;
+  long a = 0, b = 0;
+  pool.invoke([&] { a = Fib(pool, n - 1); }, [&] { b = Fib(pool, n - 2); });
+  return a + b;
+}
+
+long long Sum(s21::fork_join_pool& pool, const int* first, size_t n) {
+  if (n <= 1000) return std::accumulate(first, first + n, 0LL);
+  long long left = 0, right = 0;
+  pool.invoke([&] { left = Sum(pool, first, n / 2); },
+              [&] { right = Sum(pool, first + n / 2, n - n / 2); });
+  return left + right;
+}
+}  // namespace
+
+TEST(ForkJoinPool, Fib) {
+  s21::fork_join_pool pool(4);
+  EXPECT_EQ(pool.size(), 4UL);
+  long result = 0;
+  pool.run([&] { result = Fib(pool, 20); });
+  EXPECT_EQ(result, 6765);
+  EXPECT_EQ(Fib(pool, 15), 610);
+}
+
+TEST(ForkJoinPool, ParallelSum) {
+  s21::vector<int> data(200000);
+  for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<int>(i % 97);
+  long long expected = std::accumulate(data.begin(), data.end(), 0LL);
+  s21::fork_join_pool pool(3);
+  long long total = 0;
+  pool.run([&] { total = Sum(pool, data.data(), data.size()); });
+  EXPECT_EQ(total, expected);
+}
+
+TEST(ForkJoinPool, SingleWorker) {
+  s21::fork_join_pool pool(1);
+  EXPECT_EQ(Fib(pool, 12), 144);
+}
+
+TEST(ForkJoinPool, ExternalCallers) {
+  s21::fork_join_pool pool(2);
+  std::atomic<long> total{0};
+  std::vector<std::thread> callers;
+  for (int i = 0; i < 4; ++i)
+    callers.emplace_back([&] { total += Fib(pool, 14); });
+  for (auto& t : callers) t.join();
+  EXPECT_EQ(total.load(), 4 * 377);
+}
+
+TEST(ForkJoinPool, Exception) {
+  s21::fork_join_pool pool(2);
+  std::atomic<int> ran{0};
+  EXPECT_THROW(pool.invoke([&] { ++ran; },
+                           [&] {
+                             ++ran;
+                             throw std::runtime_error("forked");
+                           }),
+               std::runtime_error);
+  EXPECT_EQ(ran.load(), 2);
+  EXPECT_THROW(pool.run([] { throw std::logic_error("root"); }),
+               std::logic_error);
+  EXPECT_EQ(Fib(pool, 10), 55);
+}
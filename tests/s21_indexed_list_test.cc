@@ -0,0 +1,166 @@
+#include <list>
+#include <string>
+#include <vector>
+
+#include "s21_main_test.h"
+
+template <typename T>
+void compare_indexed_lists(const std::vector<T>& std_vec,
+                           const s21::indexed_list<T>& s21_list) {
+  EXPECT_EQ(std_vec.size(), s21_list.size());
+  if (std_vec.size() == s21_list.size()) {
+    size_t i = 0;
+    for (const T& el : s21_list) EXPECT_EQ(std_vec[i++], el);
+    for (i = 0; i < std_vec.size(); ++i) EXPECT_EQ(std_vec[i], s21_list[i]);
+  }
+}
+
+TEST(IndexedList, ConstructorDefault) {
+  s21::indexed_list<int> a;
+  EXPECT_EQ(a.size(), 0UL);
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.begin(), a.end());
+}
+
+TEST(IndexedList, ConstructorParameterized) {
+  s21::indexed_list<int> a(5);
+  compare_indexed_lists({0, 0, 0, 0, 0}, a);
+}
+
+TEST(IndexedList, ConstructorCopyMove) {
+  std::vector<std::string> a{"a", "b", "c", "d"};
+  s21::indexed_list<std::string> b{"a", "b", "c", "d"};
+  s21::indexed_list<std::string> c(b);
+  s21::indexed_list<std::string> d(std::move(b));
+  EXPECT_TRUE(b.empty());
+  compare_indexed_lists(a, c);
+  compare_indexed_lists(a, d);
+  b = c;
+  c = std::move(d);
+  compare_indexed_lists(a, b);
+  compare_indexed_lists(a, c);
+}
+
+TEST(IndexedList, At) {
+  s21::indexed_list<int> a{1, 2, 3};
+  EXPECT_EQ(a.at(0), 1);
+  EXPECT_EQ(a.at(2), 3);
+  a.at(1) = 5;
+  EXPECT_EQ(a[1], 5);
+  EXPECT_THROW(a.at(3), std::out_of_range);
+  EXPECT_EQ(a.front(), 1);
+  EXPECT_EQ(a.back(), 3);
+  s21::indexed_list<int> b;
+  EXPECT_THROW(b.front(), std::out_of_range);
+  EXPECT_THROW(b.back(), std::out_of_range);
+  EXPECT_THROW(b.pop_back(), std::out_of_range);
+  EXPECT_THROW(b.pop_front(), std::out_of_range);
+}
+
+TEST(IndexedList, InsertEraseAtRandom) {
+  std::vector<int> a;
+  s21::indexed_list<int> b;
+  unsigned x = 1;
+  for (int i = 0; i < 3000; ++i) {
+    x = x * 1103515245u + 12345u;
+    size_t pos = (x >> 8) % (a.size() + 1);
+    if (i % 3 == 2 && !a.empty()) {
+      pos %= a.size();
+      a.erase(a.begin() + pos);
+      b.erase_at(pos);
+    } else {
+      a.insert(a.begin() + pos, i);
+      auto it = b.insert_at(pos, i);
+      EXPECT_EQ(*it, i);
+      EXPECT_EQ(it.index(), pos);
+    }
+  }
+  compare_indexed_lists(a, b);
+  EXPECT_THROW(b.insert_at(b.size() + 1, 0), std::out_of_range);
+  EXPECT_THROW(b.erase_at(b.size()), std::out_of_range);
+}
+
+TEST(IndexedList, IteratorArithmetic) {
+  s21::indexed_list<int> a;
+  for (int i = 0; i < 100; ++i) a.push_back(i);
+  auto it = a.begin() + 40;
+  EXPECT_EQ(*it, 40);
+  it += 50;
+  EXPECT_EQ(*it, 90);
+  it -= 85;
+  EXPECT_EQ(*it, 5);
+  EXPECT_EQ(*(it - 5), 0);
+  EXPECT_EQ(a.begin() + 100, a.end());
+  auto back = a.end();
+  for (int i = 99; i >= 0; --i) EXPECT_EQ(*--back, i);
+}
+
+TEST(IndexedList, IteratorsSurviveErase) {
+  s21::indexed_list<int> a;
+  for (int i = 0; i < 64; ++i) a.push_back(i);
+  auto keep = a.begin() + 31;
+  auto last = a.end();
+  --last;
+  for (int i = 0; i < 30; ++i) a.erase_at(i % 2 ? 0 : a.size() - 2);
+  EXPECT_EQ(*keep, 31);
+  EXPECT_EQ(*last, 63);
+  EXPECT_EQ(a.size(), 34UL);
+  a.erase(keep);
+  EXPECT_EQ(a.size(), 33UL);
+}
+
+TEST(IndexedList, IteratorsSurviveSwap) {
+  s21::indexed_list<int> a;
+  s21::indexed_list<int> b{7, 8};
+  for (int i = 0; i < 50; ++i) a.push_back(i);
+  auto it = a.begin() + 10;
+  a.swap(b);
+  EXPECT_EQ(it.index(), 10UL);
+  it += 30;
+  EXPECT_EQ(*it, 40);
+  it -= 40;
+  EXPECT_EQ(it, b.begin());
+  EXPECT_EQ(it + 50, b.end());
+  s21::indexed_list<int> c(std::move(b));
+  EXPECT_EQ(*(it + 49), 49);
+  c.erase(it + 1);
+  EXPECT_EQ(c[1], 2);
+}
+
+TEST(IndexedList, PushPop) {
+  std::list<int> a;
+  s21::indexed_list<int> b;
+  for (int i = 0; i < 50; ++i) {
+    a.push_front(i);
+    b.push_front(i);
+    a.push_back(-i);
+    b.push_back(-i);
+  }
+  for (int i = 0; i < 20; ++i) {
+    a.pop_front();
+    b.pop_front();
+    a.pop_back();
+    b.pop_back();
+  }
+  compare_indexed_lists(std::vector<int>(a.begin(), a.end()), b);
+}
+
+TEST(IndexedList, InsertMany) {
+  std::vector<int> a{0, 1, 2, 3, 4, 5, 6};
+  s21::indexed_list<int> b{0, 4};
+  auto it = b.insert_many(b.begin() + 1, 1, 2, 3);
+  EXPECT_EQ(*it, 4);
+  b.insert_many_back(5, 6);
+  compare_indexed_lists(a, b);
+  b.insert_many_front(-2, -1);
+  a.insert(a.begin(), {-2, -1});
+  compare_indexed_lists(a, b);
+}
+
+TEST(IndexedList, Clear) {
+  s21::indexed_list<std::string> a{"a", "b"};
+  a.clear();
+  EXPECT_TRUE(a.empty());
+  a.push_back("c");
+  EXPECT_EQ(a.front(), "c");
+}
@@ -0,0 +1,185 @@
+#include <string>
+#include <vector>
+
+#include "s21_main_test.h"
+
+struct session {
+  int id;
+  s21::intrusive_list_hook hook;
+  s21::intrusive_list_hook timeout_hook;
+};
+
+using session_list = s21::intrusive_list<session, &session::hook>;
+using timeout_list = s21::intrusive_list<session, &session::timeout_hook>;
+
+void compare_ids(const std::vector<int>& ids, const session_list& list) {
+  EXPECT_EQ(ids.size(), list.size());
+  auto it = list.begin();
+  for (int id : ids) {
+    if (it == list.end()) break;
+    EXPECT_EQ(id, it->id);
+    ++it;
+  }
+}
+
+TEST(IntrusiveList, ConstructorDefault) {
+  session_list a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0UL);
+  EXPECT_EQ(a.begin(), a.end());
+  EXPECT_THROW(a.front(), std::out_of_range);
+  EXPECT_THROW(a.pop_back(), std::out_of_range);
+}
+
+TEST(IntrusiveList, PushPop) {
+  session s[4] = {{1, {}, {}}, {2, {}, {}}, {3, {}, {}}, {4, {}, {}}};
+  session_list a;
+  a.push_back(s[1]);
+  a.push_back(s[2]);
+  a.push_front(s[0]);
+  a.push_back(s[3]);
+  compare_ids({1, 2, 3, 4}, a);
+  EXPECT_EQ(&a.front(), &s[0]);
+  EXPECT_EQ(&a.back(), &s[3]);
+  a.pop_front();
+  a.pop_back();
+  EXPECT_FALSE(s[0].hook.is_linked());
+  EXPECT_FALSE(s[3].hook.is_linked());
+  compare_ids({2, 3}, a);
+}
+
+TEST(IntrusiveList, EraseFromAnywhere) {
+  session s[5];
+  session_list a;
+  for (int i = 0; i < 5; ++i) {
+    s[i].id = i;
+    a.push_back(s[i]);
+  }
+  a.erase(s[2]);
+  a.erase(s[2]);
+  a.erase(session_list::iterator_to(s[4]));
+  compare_ids({0, 1, 3}, a);
+  auto it = a.insert(session_list::iterator_to(s[3]), s[2]);
+  EXPECT_EQ(it->id, 2);
+  compare_ids({0, 1, 2, 3}, a);
+}
+
+#ifndef NDEBUG
+TEST(IntrusiveList, EraseForeignElementAsserts) {
+  ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+  session s{1, {}, {}};
+  session_list a;
+  session_list b;
+  a.push_back(s);
+  EXPECT_DEATH(b.erase(s), "contains");
+  EXPECT_EQ(a.size(), 1UL);
+  EXPECT_EQ(b.size(), 0UL);
+}
+#endif
+
+TEST(IntrusiveList, DoubleInsertThrows) {
+  session s{1, {}, {}};
+  session_list a;
+  session_list b;
+  a.push_back(s);
+  EXPECT_THROW(b.push_back(s), std::logic_error);
+  EXPECT_EQ(b.size(), 0UL);
+  a.clear();
+  EXPECT_FALSE(s.hook.is_linked());
+  b.push_back(s);
+  EXPECT_EQ(b.size(), 1UL);
+}
+
+TEST(IntrusiveList, TwoHooks) {
+  session s[3] = {{1, {}, {}}, {2, {}, {}}, {3, {}, {}}};
+  session_list a;
+  timeout_list b;
+  for (auto& el : s) {
+    a.push_back(el);
+    b.push_front(el);
+  }
+  EXPECT_EQ(a.front().id, 1);
+  EXPECT_EQ(b.front().id, 3);
+  b.erase(s[1]);
+  EXPECT_TRUE(s[1].hook.is_linked());
+  EXPECT_FALSE(s[1].timeout_hook.is_linked());
+  EXPECT_EQ(b.size(), 2UL);
+}
+
+TEST(IntrusiveList, CopyIsUnlinked) {
+  session s{1, {}, {}};
+  session_list a;
+  a.push_back(s);
+  session c = s;
+  EXPECT_FALSE(c.hook.is_linked());
+  c = s;
+  EXPECT_FALSE(c.hook.is_linked());
+}
+
+TEST(IntrusiveList, MoveAndSwap) {
+  session s[4] = {{1, {}, {}}, {2, {}, {}}, {3, {}, {}}, {4, {}, {}}};
+  session_list a;
+  a.push_back(s[0]);
+  a.push_back(s[1]);
+  session_list b(std::move(a));
+  EXPECT_TRUE(a.empty());
+  compare_ids({1, 2}, b);
+  session_list c;
+  c.push_back(s[2]);
+  c.swap(b);
+  compare_ids({3}, b);
+  compare_ids({1, 2}, c);
+  b = std::move(c);
+  EXPECT_FALSE(s[2].hook.is_linked());
+  compare_ids({1, 2}, b);
+  b.push_back(s[3]);
+  compare_ids({1, 2, 4}, b);
+}
+
+TEST(IntrusiveList, Splice) {
+  session s[6];
+  session_list a;
+  session_list b;
+  for (int i = 0; i < 6; ++i) {
+    s[i].id = i;
+    (i < 3 ? a : b).push_back(s[i]);
+  }
+  a.splice(session_list::iterator_to(s[1]), b);
+  EXPECT_TRUE(b.empty());
+  compare_ids({0, 3, 4, 5, 1, 2}, a);
+  b.splice(b.end(), a, session_list::iterator_to(s[4]));
+  compare_ids({0, 3, 5, 1, 2}, a);
+  compare_ids({4}, b);
+  b.splice(b.begin(), a, session_list::iterator_to(s[3]),
+           session_list::iterator_to(s[2]));
+  compare_ids({0, 2}, a);
+  compare_ids({3, 5, 1, 4}, b);
+}
+
+TEST(IntrusiveList, LruMoveToFront) {
+  session s[4];
+  session_list a;
+  for (int i = 0; i < 4; ++i) {
+    s[i].id = i;
+    a.push_back(s[i]);
+  }
+  a.splice(a.begin(), a, session_list::iterator_to(s[2]));
+  a.splice(a.begin(), a, session_list::iterator_to(s[2]));
+  a.splice(a.end(), a, session_list::iterator_to(s[0]));
+  compare_ids({2, 1, 3, 0}, a);
+  EXPECT_EQ(a.size(), 4UL);
+}
+
+TEST(IntrusiveList, Reverse) {
+  session s[5];
+  session_list a;
+  for (int i = 0; i < 5; ++i) {
+    s[i].id = i;
+    a.push_back(s[i]);
+  }
+  a.reverse();
+  compare_ids({4, 3, 2, 1, 0}, a);
+  auto it = a.end();
+  --it;
+  EXPECT_EQ(it->id, 0);
+}
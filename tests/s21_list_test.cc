@@ -1,4 +1,8 @@
 #include <list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
 
 #include "s21_main_test.h"
 
@@ -241,3 +245,302 @@ TEST(List, MethodInsertMany) {
   EXPECT_EQ(b.size(), 8UL);
   compare_lists(a, b);
 }
+
+TEST(List, MethodClearKeepsListUsable) {
+  std::list<std::string> a{"x", "y"};
+  s21::list<std::string> b{"a", "b", "c"};
+  b.clear();
+  EXPECT_TRUE(b.empty());
+  b.push_back("x");
+  b.push_back("y");
+  compare_lists(a, b);
+}
+
+TEST(List, NodeChurn) {
+  std::list<std::string> a;
+  s21::list<std::string> b;
+  for (int round = 0; round < 50; ++round) {
+    for (int i = 0; i < 100; ++i) {
+      a.push_back(std::to_string(i));
+      b.push_back(std::to_string(i));
+      a.push_front(std::to_string(-i));
+      b.push_front(std::to_string(-i));
+    }
+    for (int i = 0; i < 90; ++i) {
+      a.pop_back();
+      b.pop_back();
+      a.pop_front();
+      b.pop_front();
+    }
+  }
+  std::list<std::string> c(a);
+  s21::list<std::string> d(b);
+  compare_lists(a, b);
+  b.clear();
+  compare_lists(c, d);
+}
+
+TEST(List, NodePool) {
+  s21::node_pool<std::pair<int, int>>* pool =
+      s21::node_pool<std::pair<int, int>>::create();
+  auto* first = pool->allocate();
+  EXPECT_EQ(pool->chunks(), 1UL);
+  pool->deallocate(first);
+  EXPECT_EQ(pool->allocate(), first);
+  for (int i = 0; i < 100; ++i) pool->allocate();
+  EXPECT_EQ(pool->chunks(), 3UL);
+  pool->deallocate_remote(first);
+  EXPECT_EQ(pool->allocate(), first);
+  pool->release(101);
+}
+
+TEST(List, SplicedNodesOutliveTheirPool) {
+  s21::list<std::string> a;
+  for (int round = 0; round < 1000; ++round) {
+    s21::list<std::string> donor{"x" + std::to_string(round), "tail"};
+    a.splice(a.end(), donor, donor.begin());
+    if (round % 2) a.pop_front();
+  }
+  EXPECT_EQ(a.size(), 500UL);
+  EXPECT_EQ(a.back(), "x999");
+  a.clear();
+  a.push_back("again");
+  EXPECT_EQ(a.front(), "again");
+}
+
+TEST(List, MethodSortLarge) {
+  std::list<int> a;
+  s21::list<int> b;
+  unsigned x = 7;
+  for (int i = 0; i < 100000; ++i) {
+    x = x * 1103515245 + 12345;
+    a.push_back((x >> 8) % 1000);
+    b.push_back((x >> 8) % 1000);
+  }
+  a.sort();
+  b.sort();
+  compare_lists(a, b);
+}
+
+TEST(List, MethodSortRuns) {
+  std::list<int> a;
+  s21::list<int> b;
+  for (int i = 0; i < 1000; ++i) {
+    a.push_back(i % 100 < 50 ? i : 1000 - i);
+    b.push_back(i % 100 < 50 ? i : 1000 - i);
+  }
+  a.sort();
+  b.sort();
+  compare_lists(a, b);
+  s21::list<int> sorted{1, 2, 3, 4, 5};
+  s21::list<int> reversed{5, 4, 3, 2, 1};
+  sorted.sort();
+  reversed.sort();
+  std::list<int> c{1, 2, 3, 4, 5};
+  std::list<int> d{1, 2, 3, 4, 5};
+  compare_lists(c, sorted);
+  compare_lists(d, reversed);
+}
+
+TEST(List, MethodSortComparatorStable) {
+  using item = std::pair<int, int>;
+  std::list<item> a;
+  s21::list<item> b;
+  for (int i = 0; i < 500; ++i) {
+    a.push_back({i % 7, i});
+    b.push_back({i % 7, i});
+  }
+  auto by_key_desc = [](const item& l, const item& r) {
+    return l.first > r.first;
+  };
+  a.sort(by_key_desc);
+  b.sort(by_key_desc);
+  compare_lists(a, b);
+}
+
+TEST(List, MethodSortKeepsNodes) {
+  s21::list<int> a{3, 1, 2};
+  auto it = a.begin();
+  a.sort();
+  EXPECT_EQ(*it, 3);
+  ++it;
+  EXPECT_EQ(it, a.end());
+  --it;
+  --it;
+  EXPECT_EQ(*it, 2);
+  EXPECT_EQ(a.back(), 3);
+  EXPECT_EQ(a.front(), 1);
+}
+
+TEST(List, MethodReverseKeepsNodes) {
+  s21::list<int> a{1, 2, 3};
+  auto it = a.begin();
+  a.reverse();
+  EXPECT_EQ(*it, 1);
+  ++it;
+  EXPECT_EQ(it, a.end());
+  EXPECT_EQ(a.front(), 3);
+  a.push_back(0);
+  std::list<int> b{3, 2, 1, 0};
+  compare_lists(b, a);
+}
+
+TEST(List, MethodMergeTail) {
+  std::list<int> a{1, 2, 3, 4, 5, 6, 7};
+  s21::list<int> b{1, 3};
+  s21::list<int> c{2, 4, 5, 6, 7};
+  b.merge(c);
+  EXPECT_EQ(c.size(), 0UL);
+  EXPECT_TRUE(c.empty());
+  compare_lists(a, b);
+}
+
+TEST(List, MethodMergeComparatorStable) {
+  using item = std::pair<int, int>;
+  std::list<item> a{{5, 0}, {3, 0}, {3, 1}, {1, 0}};
+  std::list<item> b{{4, 1}, {3, 2}, {1, 1}, {0, 1}};
+  s21::list<item> c{{5, 0}, {3, 0}, {3, 1}, {1, 0}};
+  s21::list<item> d{{4, 1}, {3, 2}, {1, 1}, {0, 1}};
+  auto by_key_desc = [](const item& l, const item& r) {
+    return l.first > r.first;
+  };
+  a.merge(b, by_key_desc);
+  c.merge(d, by_key_desc);
+  compare_lists(a, c);
+}
+
+TEST(List, MethodSpliceKeepsNodes) {
+  s21::list<std::string> a{"a", "b"};
+  s21::list<std::string> b{"c", "d"};
+  auto it = b.begin();
+  a.splice(a.end(), b);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(*it, "c");
+  b.push_back("e");
+  b.clear();
+  a.pop_front();
+  a.push_back("f");
+  std::list<std::string> c{"b", "c", "d", "f"};
+  compare_lists(c, a);
+}
+
+TEST(List, MethodSpliceElement) {
+  std::list<int> a{1, 4, 2, 3};
+  std::list<int> b{5, 6};
+  s21::list<int> c{1, 2, 3};
+  s21::list<int> d{4, 5, 6};
+  auto pos = c.begin();
+  ++pos;
+  c.splice(pos, d, d.begin());
+  EXPECT_EQ(c.size(), 4UL);
+  EXPECT_EQ(d.size(), 2UL);
+  compare_lists(a, c);
+  compare_lists(b, d);
+}
+
+TEST(List, MethodSpliceElementSameList) {
+  std::list<int> a{3, 1, 2};
+  s21::list<int> b{1, 2, 3};
+  auto it = b.begin();
+  ++it;
+  ++it;
+  b.splice(b.begin(), b, it);
+  b.splice(b.begin(), b, b.begin());
+  EXPECT_EQ(b.size(), 3UL);
+  compare_lists(a, b);
+}
+
+TEST(List, MethodSpliceRange) {
+  std::list<int> a{1, 5, 6, 2};
+  std::list<int> b{4, 7};
+  s21::list<int> c{1, 2};
+  s21::list<int> d{4, 5, 6, 7};
+  auto first = d.begin();
+  ++first;
+  auto last = first;
+  ++last;
+  ++last;
+  auto pos = c.begin();
+  ++pos;
+  c.splice(pos, d, first, last);
+  EXPECT_EQ(c.size(), 4UL);
+  EXPECT_EQ(d.size(), 2UL);
+  compare_lists(b, d);
+  d.push_back(8);
+  d.clear();
+  c.push_back(0);
+  a.push_back(0);
+  compare_lists(a, c);
+}
+
+TEST(List, MethodSpliceRangeToEnd) {
+  std::list<int> a{2, 3, 1};
+  s21::list<int> b{1, 2, 3};
+  auto first = b.begin();
+  ++first;
+  b.splice(b.begin(), b, first, b.end());
+  b.pop_back();
+  a.pop_back();
+  compare_lists(a, b);
+}
+
+TEST(List, MethodMergeThrowingCompare) {
+  s21::list<int> a{1, 3, 5};
+  s21::list<int> b{2, 4, 6};
+  int calls = 0;
+  EXPECT_THROW(a.merge(b,
+                       [&calls](int x, int y) {
+                         if (++calls == 4) throw std::runtime_error("cmp");
+                         return x < y;
+                       }),
+               std::runtime_error);
+  EXPECT_EQ(a.size() + b.size(), 6UL);
+  size_t count = 0;
+  for (auto it = a.begin(); it != a.end(); ++it) ++count;
+  EXPECT_EQ(count, a.size());
+  b.clear();
+  a.push_back(7);
+  EXPECT_EQ(a.back(), 7);
+}
+
+TEST(List, SplicedListsClearedOnTwoThreads) {
+  for (int round = 0; round < 50; ++round) {
+    s21::list<int> a{1, 2, 3};
+    s21::list<int> b{4, 5, 6};
+    a.splice(a.end(), b, b.begin());
+    b.splice(b.end(), a, a.begin());
+    std::thread t([&a] { a.clear(); });
+    b.clear();
+    t.join();
+    EXPECT_TRUE(a.empty());
+    EXPECT_TRUE(b.empty());
+  }
+}
+
+TEST(List, MethodEmplace) {
+  s21::list<std::string> a;
+  a.emplace_back(3, 'b');
+  a.emplace_front("a");
+  auto it = a.emplace(a.end(), 2, 'c');
+  EXPECT_EQ(*it, "cc");
+  std::string s(100, 'd');
+  a.push_back(std::move(s));
+  a.insert(a.begin(), std::string("z"));
+  std::list<std::string> b{"z", "a", "bbb", "cc", std::string(100, 'd')};
+  compare_lists(b, a);
+}
+
+TEST(List, MoveOnly) {
+  s21::list<std::unique_ptr<int>> a;
+  a.push_back(std::make_unique<int>(2));
+  a.push_front(std::make_unique<int>(1));
+  a.emplace_back(new int(4));
+  auto it = a.end();
+  --it;
+  a.insert(it, std::make_unique<int>(3));
+  a.insert_many_back(std::make_unique<int>(5), std::make_unique<int>(6));
+  a.insert_many_front(std::make_unique<int>(-1), std::make_unique<int>(0));
+  EXPECT_EQ(a.size(), 8UL);
+  int expected = -1;
+  for (auto i = a.begin(); i != a.end(); ++i) EXPECT_EQ(**i, expected++);
+}
@@ -0,0 +1,136 @@
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "s21_main_test.h"
+
+struct Record {
+  int id;
+  double value;
+};
+
+std::string temp_path(const char* name) {
+  std::string path = std::string("/tmp/s21_mmap_") + name + "_" +
+                     std::to_string(::getpid());
+  ::unlink(path.c_str());
+  return path;
+}
+
+TEST(MmapVector, ConstructorCreatesEmptyFile) {
+  std::string path = temp_path("create");
+  {
+    s21::mmap_vector<int> a(path);
+    EXPECT_EQ(a.size(), 0UL);
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(a.begin(), a.end());
+  }
+  ::unlink(path.c_str());
+}
+
+TEST(MmapVector, MethodPushBackGrows) {
+  std::string path = temp_path("grow");
+  {
+    std::vector<int> a;
+    s21::mmap_vector<int> b(path);
+    for (int i = 0; i < 100000; ++i) {
+      a.push_back(i * 3);
+      b.push_back(i * 3);
+    }
+    EXPECT_EQ(a.size(), b.size());
+    EXPECT_GE(b.capacity(), b.size());
+    EXPECT_TRUE(std::equal(a.begin(), a.end(), b.begin()));
+    EXPECT_EQ(b.front(), 0);
+    EXPECT_EQ(b.back(), 299997);
+    EXPECT_THROW(b.at(100000), std::out_of_range);
+  }
+  ::unlink(path.c_str());
+}
+
+TEST(MmapVector, ReopenKeepsContents) {
+  std::string path = temp_path("reopen");
+  {
+    s21::mmap_vector<Record> a(path);
+    for (int i = 0; i < 1000; ++i) a.push_back({i, i * 0.5});
+    a.sync();
+  }
+  {
+    s21::mmap_vector<Record> b(path);
+    EXPECT_EQ(b.size(), 1000UL);
+    EXPECT_EQ(b[999].id, 999);
+    EXPECT_DOUBLE_EQ(b[10].value, 5.0);
+    b.pop_back();
+    b.shrink_to_fit();
+    EXPECT_EQ(b.capacity(), 999UL);
+    struct stat st;
+    ASSERT_EQ(::stat(path.c_str(), &st), 0);
+    EXPECT_EQ(static_cast<size_t>(st.st_size), 64 + 999 * sizeof(Record));
+    EXPECT_EQ(b[998].id, 998);
+  }
+  {
+    s21::mmap_vector<Record> c(path);
+    EXPECT_EQ(c.size(), 999UL);
+    EXPECT_EQ(c.capacity(), 999UL);
+  }
+  ::unlink(path.c_str());
+}
+
+TEST(MmapVector, MethodReserveClear) {
+  std::string path = temp_path("reserve");
+  {
+    s21::mmap_vector<double> a(path);
+    a.reserve(500);
+    EXPECT_EQ(a.capacity(), 500UL);
+    a.push_back(1.5);
+    a.clear();
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(a.capacity(), 500UL);
+  }
+  ::unlink(path.c_str());
+}
+
+TEST(MmapVector, IncompatibleFileThrows) {
+  std::string path = temp_path("bad");
+  {
+    std::ofstream out(path);
+    out << "definitely not a vector, but long enough to hold a header......";
+  }
+  EXPECT_THROW(s21::mmap_vector<int> a(path), std::runtime_error);
+  {
+    s21::mmap_vector<int> a(path + "_ok");
+    a.push_back(1);
+  }
+  EXPECT_THROW(s21::mmap_vector<double> b(path + "_ok"), std::runtime_error);
+  {
+    std::ofstream out(path + "_ok", std::ios::binary | std::ios::app);
+    out << 'x';
+  }
+  EXPECT_THROW(s21::mmap_vector<int> c(path + "_ok"), std::runtime_error);
+  ::unlink(path.c_str());
+  ::unlink((path + "_ok").c_str());
+}
+
+TEST(MmapVector, MoveAndSwap) {
+  std::string path1 = temp_path("swap1");
+  std::string path2 = temp_path("swap2");
+  {
+    s21::mmap_vector<int> a(path1);
+    s21::mmap_vector<int> b(path2);
+    a.push_back(1);
+    b.push_back(2);
+    b.push_back(3);
+    a.swap(b);
+    EXPECT_EQ(a.size(), 2UL);
+    EXPECT_EQ(b[0], 1);
+    s21::mmap_vector<int> c(std::move(a));
+    EXPECT_EQ(c[1], 3);
+    EXPECT_EQ(a.size(), 0UL);
+    a.clear();
+    a.pop_back();
+    EXPECT_TRUE(a.empty());
+  }
+  ::unlink(path1.c_str());
+  ::unlink(path2.c_str());
+}
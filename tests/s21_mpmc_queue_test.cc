@@ -0,0 +1,109 @@
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_main_test.h"
+
+TEST(MpmcQueue, Capacity) {
+  s21::mpmc_queue<int> a(5);
+  EXPECT_EQ(a.capacity(), 8UL);
+  EXPECT_TRUE(a.empty());
+  s21::mpmc_queue<int> b(1);
+  EXPECT_EQ(b.capacity(), 2UL);
+}
+
+TEST(MpmcQueue, PushPop) {
+  s21::mpmc_queue<std::string> a(4);
+  std::string out;
+  EXPECT_FALSE(a.try_pop(out));
+  EXPECT_TRUE(a.try_push("a"));
+  std::string b = "b";
+  EXPECT_TRUE(a.try_push(b));
+  EXPECT_TRUE(a.try_emplace(2, 'c'));
+  a.push(std::string("d"));
+  EXPECT_FALSE(a.try_push("e"));
+  EXPECT_EQ(a.size(), 4UL);
+  EXPECT_TRUE(a.try_pop(out));
+  EXPECT_EQ(out, "a");
+  a.pop(out);
+  EXPECT_EQ(out, "b");
+  EXPECT_TRUE(a.try_pop(out));
+  EXPECT_EQ(out, "cc");
+  EXPECT_EQ(a.size(), 1UL);
+  EXPECT_TRUE(a.try_push("e"));
+  EXPECT_TRUE(a.try_pop(out));
+  EXPECT_EQ(out, "d");
+  EXPECT_TRUE(a.try_pop(out));
+  EXPECT_EQ(out, "e");
+  EXPECT_TRUE(a.empty());
+  EXPECT_FALSE(a.try_pop(out));
+}
+
+TEST(MpmcQueue, WrapAround) {
+  s21::mpmc_queue<int> a(8);
+  int next = 0;
+  int expected = 0;
+  for (int round = 0; round < 100; ++round) {
+    for (int i = 0; i < 5; ++i) EXPECT_TRUE(a.try_push(next++));
+    for (int i = 0; i < 5; ++i) {
+      int out = -1;
+      EXPECT_TRUE(a.try_pop(out));
+      EXPECT_EQ(out, expected++);
+    }
+  }
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(MpmcQueue, MoveOnly) {
+  s21::mpmc_queue<std::unique_ptr<int>> a(2);
+  a.push(std::make_unique<int>(1));
+  a.emplace(new int(2));
+  std::unique_ptr<int> out;
+  a.pop(out);
+  EXPECT_EQ(*out, 1);
+  a.pop(out);
+  EXPECT_EQ(*out, 2);
+}
+
+TEST(MpmcQueue, DestroysRemaining) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::mpmc_queue<std::shared_ptr<int>> a(4);
+    a.push(counter);
+    a.push(counter);
+    std::shared_ptr<int> out;
+    a.pop(out);
+    a.push(counter);
+    out.reset();
+    EXPECT_EQ(counter.use_count(), 3);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(MpmcQueue, ManyThreads) {
+  const int producers = 4;
+  const int consumers = 4;
+  const int per_producer = 20000;
+  s21::mpmc_queue<int> a(16);
+  std::vector<std::thread> threads;
+  std::vector<long long> sums(consumers, 0);
+  for (int p = 0; p < producers; ++p)
+    threads.emplace_back([&a, p] {
+      for (int i = 0; i < per_producer; ++i) a.push(p * per_producer + i);
+    });
+  for (int c = 0; c < consumers; ++c)
+    threads.emplace_back([&a, &sums, c] {
+      for (int i = 0; i < per_producer * producers / consumers; ++i) {
+        int out;
+        a.pop(out);
+        sums[c] += out;
+      }
+    });
+  for (auto& t : threads) t.join();
+  long long total = 0;
+  for (long long s : sums) total += s;
+  long long n = producers * per_producer;
+  EXPECT_EQ(total, n * (n - 1) / 2);
+  EXPECT_TRUE(a.empty());
+}
@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "s21_main_test.h"
+
+s21::vector<int> make_random(size_t n) {
+  s21::vector<int> v;
+  unsigned x = 12345;
+  for (size_t i = 0; i < n; ++i) {
+    x = x * 1103515245 + 12345;
+    v.push_back(static_cast<int>((x >> 8) % 100000));
+  }
+  return v;
+}
+
+TEST(Parallel, ThreadPoolRunsEveryTask) {
+  s21::parallel::thread_pool pool(4);
+  EXPECT_EQ(pool.size(), 4UL);
+  std::vector<std::atomic<int>> hits(1000);
+  for (int round = 0; round < 3; ++round)
+    pool.run(1000, [&](size_t i) { ++hits[i]; });
+  for (auto& h : hits) EXPECT_EQ(h.load(), 3);
+}
+
+TEST(Parallel, ThreadPoolNestedRun) {
+  s21::parallel::thread_pool pool(4);
+  std::atomic<int> total(0);
+  pool.run(8, [&](size_t) { pool.run(8, [&](size_t) { ++total; }); });
+  EXPECT_EQ(total.load(), 64);
+}
+
+TEST(Parallel, ThreadPoolPropagatesException) {
+  s21::parallel::thread_pool pool(3);
+  EXPECT_THROW(pool.run(100,
+                        [](size_t i) {
+                          if (i == 42) throw std::runtime_error("task");
+                        }),
+               std::runtime_error);
+  std::atomic<int> total(0);
+  pool.run(10, [&](size_t) { ++total; });
+  EXPECT_EQ(total.load(), 10);
+}
+
+TEST(Parallel, Sort) {
+  for (size_t threads : {1, 3, 8}) {
+    s21::parallel::set_thread_count(threads);
+    EXPECT_EQ(s21::parallel::thread_count(), threads);
+    s21::vector<int> v = make_random(200000);
+    std::vector<int> ref(v.begin(), v.end());
+    std::sort(ref.begin(), ref.end());
+    s21::parallel::sort(v);
+    EXPECT_TRUE(std::equal(ref.begin(), ref.end(), v.begin()));
+    s21::parallel::sort(v, std::greater<int>());
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end(), std::greater<int>()));
+  }
+}
+
+TEST(Parallel, StableSort) {
+  s21::parallel::set_thread_count(4);
+  s21::vector<std::pair<int, int>> v;
+  for (int i = 0; i < 100000; ++i) v.push_back({(i * 7919) % 100, i});
+  std::vector<std::pair<int, int>> ref(v.begin(), v.end());
+  auto by_key = [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+    return a.first < b.first;
+  };
+  std::stable_sort(ref.begin(), ref.end(), by_key);
+  s21::parallel::stable_sort(v, by_key);
+  EXPECT_TRUE(std::equal(ref.begin(), ref.end(), v.begin()));
+}
+
+TEST(Parallel, TransformAndForEach) {
+  s21::parallel::set_thread_count(4);
+  s21::vector<int> in = make_random(100001);
+  s21::vector<long> out(in.size());
+  s21::parallel::transform(in, out, [](int x) { return 2L * x; });
+  for (size_t i = 0; i < in.size(); ++i) EXPECT_EQ(out[i], 2L * in[i]);
+  s21::parallel::for_each(out, [](long& x) { x += 1; });
+  for (size_t i = 0; i < in.size(); ++i) EXPECT_EQ(out[i], 2L * in[i] + 1);
+  s21::vector<long> wrong(3);
+  EXPECT_THROW(s21::parallel::transform(in, wrong, [](int x) { return x; }),
+               std::out_of_range);
+}
+
+TEST(Parallel, Reduce) {
+  s21::parallel::set_thread_count(6);
+  s21::vector<int> v = make_random(300000);
+  long long expected = std::accumulate(v.begin(), v.end(), 10LL);
+  EXPECT_EQ(s21::parallel::reduce(v, 10LL), expected);
+  s21::vector<int> empty;
+  EXPECT_EQ(s21::parallel::reduce(empty, 5), 5);
+  s21::vector<std::string> words{"a", "b", "c"};
+  EXPECT_EQ(s21::parallel::reduce(words, std::string(">")), ">abc");
+}
+
+TEST(Parallel, Partition) {
+  s21::parallel::set_thread_count(4);
+  s21::vector<int> v = make_random(100000);
+  std::vector<int> ref(v.begin(), v.end());
+  auto even = [](int x) { return x % 2 == 0; };
+  auto split = std::stable_partition(ref.begin(), ref.end(), even);
+  auto it = s21::parallel::partition(v, even);
+  EXPECT_EQ(it - v.begin(), split - ref.begin());
+  EXPECT_TRUE(std::equal(ref.begin(), ref.end(), v.begin()));
+  s21::vector<std::string> words{"bb", "a", "ccc", "d"};
+  auto wit = s21::parallel::partition(
+      words, [](const std::string& s) { return s.size() == 1; });
+  EXPECT_EQ(wit - words.begin(), 2);
+  EXPECT_EQ(words[0], "a");
+  EXPECT_EQ(words[3], "ccc");
+}
+
+struct FragileMove {
+  static std::atomic<int> live;
+  static std::atomic<int> moves_left;
+  int value;
+
+  FragileMove(int v = 0) : value(v) { ++live; }
+  FragileMove(const FragileMove& other) : value(other.value) { ++live; }
+  FragileMove(FragileMove&& other) : value(other.value) {
+    if (--moves_left < 0) throw std::runtime_error("move");
+    ++live;
+  }
+  FragileMove& operator=(FragileMove&& other) {
+    value = other.value;
+    return *this;
+  }
+  ~FragileMove() { --live; }
+};
+
+std::atomic<int> FragileMove::live{0};
+std::atomic<int> FragileMove::moves_left{1 << 30};
+
+TEST(Parallel, PartitionThrowingMove) {
+  s21::parallel::set_thread_count(4);
+  {
+    s21::vector<FragileMove> v;
+    v.reserve(20000);
+    for (int i = 0; i < 20000; ++i) v.push_back(FragileMove(i));
+    FragileMove::moves_left = 15000;
+    EXPECT_THROW(s21::parallel::partition(
+                     v, [](const FragileMove& x) { return x.value % 3 == 0; }),
+                 std::runtime_error);
+    EXPECT_EQ(FragileMove::live.load(), 20000);
+    FragileMove::moves_left = 1 << 30;
+  }
+  EXPECT_EQ(FragileMove::live.load(), 0);
+}
@@ -0,0 +1,193 @@
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "s21_main_test.h"
+
+namespace {
+template <typename Queue>
+std::vector<int> Drain(Queue& q) {
+  std::vector<int> out;
+  while (!q.empty()) {
+    out.push_back(q.top());
+    q.pop();
+  }
+  return out;
+}
+}  // namespace
+
+TEST(PriorityQueue, Empty) {
+  s21::priority_queue<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0UL);
+  EXPECT_THROW(a.top(), std::logic_error);
+  a.pop();
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(PriorityQueue, PushPop) {
+  s21::priority_queue<int> a;
+  a.push(3);
+  a.push(1);
+  int four = 4;
+  a.push(four);
+  a.emplace(1);
+  a.insert_many(5, 9, 2, 6);
+  EXPECT_EQ(a.size(), 8UL);
+  EXPECT_EQ(Drain(a), (std::vector<int>{9, 6, 5, 4, 3, 2, 1, 1}));
+}
+
+TEST(PriorityQueue, Compare) {
+  s21::priority_queue<int, std::greater<int>> a{5, 1, 4, 2, 3};
+  EXPECT_EQ(a.top(), 1);
+  EXPECT_EQ(Drain(a), (std::vector<int>{1, 2, 3, 4, 5}));
+}
+
+TEST(PriorityQueue, Arity) {
+  std::mt19937 gen(7);
+  std::vector<int> in(1000);
+  for (int& x : in) x = static_cast<int>(gen() % 500);
+  std::vector<int> expected = in;
+  std::sort(expected.rbegin(), expected.rend());
+  s21::priority_queue<int, std::less<int>, 2> binary(in.begin(), in.end());
+  s21::priority_queue<int> quad(in.begin(), in.end());
+  s21::priority_queue<int, std::less<int>, 8> octo;
+  for (int x : in) octo.push(x);
+  EXPECT_EQ(Drain(binary), expected);
+  EXPECT_EQ(Drain(quad), expected);
+  EXPECT_EQ(Drain(octo), expected);
+}
+
+TEST(PriorityQueue, PushRange) {
+  std::vector<int> big(200);
+  for (int i = 0; i < 200; ++i) big[i] = (i * 37) % 200;
+  s21::priority_queue<int> a{100, 300};
+  a.push_range(big.begin(), big.end());
+  int small[] = {250, -1};
+  a.push_range(small, small + 2);
+  EXPECT_EQ(a.size(), 204UL);
+  std::vector<int> out = Drain(a);
+  EXPECT_EQ(out.front(), 300);
+  EXPECT_EQ(out.back(), -1);
+  EXPECT_TRUE(std::is_sorted(out.rbegin(), out.rend()));
+}
+
+TEST(PriorityQueue, CopyMoveSwap) {
+  s21::priority_queue<std::string> a{"b", "c", "a"};
+  s21::priority_queue<std::string> b(a);
+  s21::priority_queue<std::string> c(std::move(a));
+  EXPECT_EQ(b.top(), "c");
+  EXPECT_EQ(c.size(), 3UL);
+  s21::priority_queue<std::string> d;
+  d = std::move(b);
+  d.swap(c);
+  EXPECT_TRUE(b.empty());
+  d.pop();
+  EXPECT_EQ(d.top(), "b");
+  d.clear();
+  EXPECT_TRUE(d.empty());
+}
+
+TEST(PriorityQueue, MoveOnly) {
+  auto comp = [](const std::unique_ptr<int>& x,
+                 const std::unique_ptr<int>& y) { return *x < *y; };
+  s21::priority_queue<std::unique_ptr<int>, decltype(comp)> a(comp);
+  a.push(std::make_unique<int>(2));
+  a.emplace(new int(7));
+  a.push(std::make_unique<int>(5));
+  EXPECT_EQ(*a.top(), 7);
+  a.pop();
+  EXPECT_EQ(*a.top(), 5);
+}
+
+TEST(AddressablePriorityQueue, Handles) {
+  s21::addressable_priority_queue<int, std::greater<int>> a;
+  EXPECT_THROW(a.top(), std::logic_error);
+  auto h10 = a.push(10);
+  auto h20 = a.push(20);
+  auto h30 = a.emplace(30);
+  EXPECT_EQ(a.top(), 10);
+  EXPECT_EQ(a.top_handle(), h10);
+  EXPECT_EQ(a.value(h20), 20);
+  a.decrease_key(h30, 5);
+  EXPECT_EQ(a.top_handle(), h30);
+  EXPECT_THROW(a.decrease_key(h20, 25), std::invalid_argument);
+  a.update(h30, 40);
+  EXPECT_EQ(a.top(), 10);
+  a.erase(h10);
+  EXPECT_FALSE(a.contains(h10));
+  EXPECT_THROW(a.erase(h10), std::out_of_range);
+  EXPECT_EQ(a.top_handle(), h20);
+  a.pop();
+  EXPECT_EQ(a.top(), 40);
+  EXPECT_EQ(a.size(), 1UL);
+  auto reused = a.push(1);
+  EXPECT_TRUE(reused == h10 || reused == h20);
+  EXPECT_EQ(a.top(), 1);
+  a.clear();
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(AddressablePriorityQueue, Dijkstra) {
+  const int n = 6;
+  const int inf = 1 << 30;
+  std::vector<std::vector<std::pair<int, int>>> graph(n);
+  auto edge = [&](int u, int v, int w) {
+    graph[u].push_back({v, w});
+    graph[v].push_back({u, w});
+  };
+  edge(0, 1, 7);
+  edge(0, 2, 9);
+  edge(0, 5, 14);
+  edge(1, 2, 10);
+  edge(1, 3, 15);
+  edge(2, 3, 11);
+  edge(2, 5, 2);
+  edge(3, 4, 6);
+  edge(4, 5, 9);
+  std::vector<int> dist(n, inf);
+  std::vector<size_t> handle(n);
+  s21::addressable_priority_queue<std::pair<int, int>,
+                                  std::greater<std::pair<int, int>>>
+      q;
+  dist[0] = 0;
+  for (int v = 0; v < n; ++v) handle[v] = q.push({dist[v], v});
+  while (!q.empty()) {
+    int u = q.top().second;
+    q.pop();
+    for (auto [v, w] : graph[u]) {
+      if (q.contains(handle[v]) && dist[u] + w < dist[v]) {
+        dist[v] = dist[u] + w;
+        q.decrease_key(handle[v], {dist[v], v});
+      }
+    }
+  }
+  EXPECT_EQ(dist, (std::vector<int>{0, 7, 9, 20, 20, 11}));
+}
+
+TEST(AddressablePriorityQueue, RandomAgainstSort) {
+  std::mt19937 gen(11);
+  s21::addressable_priority_queue<int, std::less<int>, 3> a;
+  std::vector<size_t> handles;
+  std::vector<int> values;
+  for (int i = 0; i < 500; ++i) {
+    int v = static_cast<int>(gen() % 1000);
+    handles.push_back(a.push(v));
+    values.push_back(v);
+  }
+  for (int i = 0; i < 500; i += 3) {
+    a.update(handles[i], values[i] = static_cast<int>(gen() % 1000));
+    if (i % 2) {
+      a.erase(handles[i]);
+      values[i] = -1;
+    }
+  }
+  std::vector<int> expected;
+  for (int v : values)
+    if (v >= 0) expected.push_back(v);
+  std::sort(expected.rbegin(), expected.rend());
+  EXPECT_EQ(Drain(a), expected);
+}
@@ -1,4 +1,6 @@
+#include <memory>
 #include <queue>
+#include <string>
 
 #include "s21_main_test.h"
 
@@ -165,4 +167,66 @@ TEST(Queue, MethodInsertManyBack) {
   my_queue.insert_many_back(10, 20, 30);
   EXPECT_EQ(my_queue.back(), 30);
   EXPECT_EQ(my_queue.size(), 8UL);
-}
\ No newline at end of file
+}
+TEST(Queue, MethodEmplace) {
+  s21::queue<std::string> a;
+  a.emplace(3, 'a');
+  std::string s(50, 'b');
+  a.push(std::move(s));
+  EXPECT_EQ(a.emplace("c"), "c");
+  EXPECT_EQ(a.front(), "aaa");
+  EXPECT_EQ(a.back(), "c");
+  EXPECT_EQ(a.size(), 3UL);
+}
+
+TEST(Queue, MoveOnly) {
+  s21::queue<std::unique_ptr<int>> a;
+  a.push(std::make_unique<int>(1));
+  a.emplace(new int(2));
+  a.insert_many_back(std::make_unique<int>(3), std::make_unique<int>(4));
+  for (int i = 1; i <= 4; ++i) {
+    EXPECT_EQ(*a.front(), i);
+    a.pop();
+  }
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(Queue, OperatorMoveAssignmentNonEmpty) {
+  s21::queue<int> a{1, 2, 3};
+  s21::queue<int> b{4};
+  b = std::move(a);
+  EXPECT_EQ(b.size(), 3UL);
+  EXPECT_EQ(b.front(), 1);
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(Queue, ListContainer) {
+  s21::queue<int, s21::list<int>> a{1, 2, 3};
+  a.push(4);
+  EXPECT_EQ(a.size(), 4UL);
+  EXPECT_EQ(a.back(), 4);
+  for (int i = 1; i <= 4; ++i) {
+    EXPECT_EQ(a.front(), i);
+    a.pop();
+  }
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(Queue, MutableFrontBack) {
+  s21::queue<std::unique_ptr<int>> a;
+  a.push(std::make_unique<int>(1));
+  a.push(std::make_unique<int>(2));
+  *a.back() = 5;
+  std::unique_ptr<int> taken = std::move(a.front());
+  a.pop();
+  EXPECT_EQ(*taken, 1);
+  EXPECT_EQ(*a.front(), 5);
+  s21::queue<int, s21::list<int>> b{1, 2};
+  b.front() = 7;
+  b.back() += 1;
+  EXPECT_EQ(b.front(), 7);
+  EXPECT_EQ(b.back(), 3);
+  a.pop();
+  EXPECT_THROW(a.front(), std::logic_error);
+  EXPECT_THROW(a.back(), std::logic_error);
+}
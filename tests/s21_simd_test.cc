@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "s21_main_test.h"
+
+const s21::simd::level kLevels[] = {
+    s21::simd::level::scalar, s21::simd::level::sse2, s21::simd::level::avx2,
+    s21::simd::level::avx512};
+
+template <typename T>
+s21::vector<T> make_column(size_t n) {
+  s21::vector<T> v;
+  for (size_t i = 0; i < n; ++i) v.push_back(static_cast<T>((i * 37) % 101));
+  return v;
+}
+
+template <typename T>
+void check_all_levels(size_t n) {
+  s21::vector<T> v = make_column<T>(n);
+  std::vector<T> ref(v.begin(), v.end());
+  for (auto lvl : kLevels) {
+    s21::simd::set_level(lvl);
+    for (T needle : {T(0), T(50), T(100), T(127)}) {
+      EXPECT_EQ(s21::simd::find(v, needle) - v.begin(),
+                std::find(ref.begin(), ref.end(), needle) - ref.begin());
+      size_t expected = std::count(ref.begin(), ref.end(), needle);
+      EXPECT_EQ(s21::simd::count(v, needle), expected);
+    }
+    if (n > 0) {
+      EXPECT_EQ(s21::simd::min_element(v) - v.begin(),
+                std::min_element(ref.begin(), ref.end()) - ref.begin());
+      EXPECT_EQ(s21::simd::max_element(v) - v.begin(),
+                std::max_element(ref.begin(), ref.end()) - ref.begin());
+    }
+    EXPECT_EQ(s21::simd::accumulate(v, T(0)),
+              std::accumulate(ref.begin(), ref.end(), T(0)));
+    s21::vector<T> copy(v);
+    EXPECT_TRUE(s21::simd::equal(v, copy));
+    if (n > 0) {
+      copy[n - 1] = T(1) + copy[n - 1];
+      EXPECT_FALSE(s21::simd::equal(v, copy));
+    }
+    s21::simd::fill(copy, T(7));
+    EXPECT_EQ(s21::simd::count(copy, T(7)), n);
+  }
+  s21::simd::set_level(s21::simd::detected_level());
+}
+
+TEST(Simd, Int32) {
+  for (size_t n : {0, 1, 7, 16, 33, 1000}) check_all_levels<int32_t>(n);
+}
+
+TEST(Simd, Int8) {
+  for (size_t n : {0, 3, 64, 1000}) check_all_levels<int8_t>(n);
+}
+
+TEST(Simd, Uint16) { check_all_levels<uint16_t>(70000); }
+
+TEST(Simd, Int64) { check_all_levels<int64_t>(1001); }
+
+TEST(Simd, Float) { check_all_levels<float>(1000); }
+
+TEST(Simd, Double) { check_all_levels<double>(999); }
+
+TEST(Simd, NanExtremes) {
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  s21::vector<double> v;
+  for (int i = 0; i < 40; ++i) v.push_back(i % 2 ? nan : double(i));
+  v[0] = nan;
+  std::vector<double> ref(v.begin(), v.end());
+  for (auto lvl : kLevels) {
+    s21::simd::set_level(lvl);
+    EXPECT_EQ(s21::simd::min_element(v) - v.begin(),
+              std::min_element(ref.begin(), ref.end()) - ref.begin());
+    EXPECT_EQ(s21::simd::max_element(v) - v.begin(),
+              std::max_element(ref.begin(), ref.end()) - ref.begin());
+  }
+  s21::simd::set_level(s21::simd::detected_level());
+}
+
+TEST(Simd, Int8AccumulateWraps) {
+  s21::vector<int8_t> v;
+  for (int i = 0; i < 300; ++i) v.push_back(int8_t(100 + i % 20));
+  std::vector<int8_t> ref(v.begin(), v.end());
+  for (auto lvl : kLevels) {
+    s21::simd::set_level(lvl);
+    EXPECT_EQ(s21::simd::accumulate(v, int8_t(-5)),
+              std::accumulate(ref.begin(), ref.end(), int8_t(-5)));
+  }
+  s21::simd::set_level(s21::simd::detected_level());
+}
+
+TEST(Simd, SetLevelIsCapped) {
+  s21::simd::set_level(s21::simd::level::avx512);
+  EXPECT_LE(s21::simd::active_level(), s21::simd::detected_level());
+  s21::simd::set_level(s21::simd::level::scalar);
+  EXPECT_EQ(s21::simd::active_level(), s21::simd::level::scalar);
+  s21::simd::set_level(s21::simd::detected_level());
+}
+
+TEST(Simd, Array) {
+  s21::array<int, 20> a{5, 3, 9, 1, 7, 1, 2, 3, 4, 5,
+                        6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+  EXPECT_EQ(*s21::simd::min_element(a), 1);
+  EXPECT_EQ(s21::simd::min_element(a) - a.begin(), 3);
+  EXPECT_EQ(*s21::simd::max_element(a), 15);
+  EXPECT_EQ(s21::simd::count(a, 1), 2UL);
+  EXPECT_EQ(s21::simd::accumulate(a, 0), 145);
+  s21::simd::fill(a, 4);
+  EXPECT_EQ(s21::simd::find(a, 4), a.begin());
+}
+
+TEST(Simd, NonArithmeticFallback) {
+  s21::vector<std::string> v{"a", "b", "c"};
+  EXPECT_EQ(s21::simd::find(v, std::string("b")), v.begin() + 1);
+  EXPECT_EQ(s21::simd::count(v, std::string("c")), 1UL);
+}
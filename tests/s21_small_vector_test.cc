@@ -0,0 +1,183 @@
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "s21_main_test.h"
+
+template <typename T, std::size_t N>
+void compare_small_vectors(std::vector<T>& std_vec,
+                           s21::small_vector<T, N>& s21_vec) {
+  EXPECT_EQ(std_vec.size(), s21_vec.size());
+  if (std_vec.size() == s21_vec.size()) {
+    for (size_t i = 0; i < std_vec.size(); ++i)
+      EXPECT_EQ(std_vec[i], s21_vec[i]);
+  }
+  return;
+}
+
+TEST(SmallVector, ConstructorDefault) {
+  s21::small_vector<int, 4> a;
+  EXPECT_EQ(a.size(), 0UL);
+  EXPECT_EQ(a.capacity(), 4UL);
+  EXPECT_TRUE(a.is_inline());
+  EXPECT_EQ(a.allocations(), 0UL);
+}
+
+TEST(SmallVector, ConstructorParametric) {
+  s21::small_vector<int, 4> a(3);
+  s21::small_vector<int, 4> b(10);
+  EXPECT_EQ(a.size(), 3UL);
+  EXPECT_TRUE(a.is_inline());
+  EXPECT_EQ(b.size(), 10UL);
+  EXPECT_FALSE(b.is_inline());
+  EXPECT_EQ(b[9], 0);
+}
+
+TEST(SmallVector, ConstructorInitializeList) {
+  std::vector<int> a{1, 2, 3, 4, 5};
+  s21::small_vector<int, 8> b{1, 2, 3, 4, 5};
+  compare_small_vectors(a, b);
+}
+
+TEST(SmallVector, ConstructorCopy) {
+  std::vector<std::string> a{"a", "b", "c"};
+  s21::small_vector<std::string, 2> b{"a", "b", "c"};
+  s21::small_vector<std::string, 2> c(b);
+  compare_small_vectors(a, c);
+}
+
+TEST(SmallVector, MoveConstructorInline) {
+  std::vector<std::string> a{"a", "b"};
+  s21::small_vector<std::string, 4> b{"a", "b"};
+  s21::small_vector<std::string, 4> c(std::move(b));
+  compare_small_vectors(a, c);
+  EXPECT_TRUE(b.empty());
+}
+
+TEST(SmallVector, MoveConstructorHeap) {
+  std::vector<int> a{1, 2, 3, 4, 5};
+  s21::small_vector<int, 2> b{1, 2, 3, 4, 5};
+  int* ptr = b.data();
+  s21::small_vector<int, 2> c(std::move(b));
+  compare_small_vectors(a, c);
+  EXPECT_EQ(c.data(), ptr);
+  EXPECT_TRUE(b.is_inline());
+}
+
+TEST(SmallVector, MethodAt) {
+  s21::small_vector<int, 4> a{1, 2, 3};
+  a.at(1) = 20;
+  EXPECT_EQ(a[1], 20);
+  EXPECT_THROW(a.at(3), std::out_of_range);
+}
+
+TEST(SmallVector, MethodFrontBack) {
+  s21::small_vector<int, 4> a{1, 2, 3};
+  EXPECT_EQ(a.front(), 1);
+  EXPECT_EQ(a.back(), 3);
+}
+
+TEST(SmallVector, SpillsOnlyOnOverflow) {
+  std::vector<int> a;
+  s21::small_vector<int, 8> b;
+  for (int i = 0; i < 8; ++i) {
+    a.push_back(i);
+    b.push_back(i);
+  }
+  EXPECT_TRUE(b.is_inline());
+  EXPECT_EQ(b.allocations(), 0UL);
+  a.push_back(8);
+  b.push_back(8);
+  EXPECT_FALSE(b.is_inline());
+  EXPECT_EQ(b.allocations(), 1UL);
+  compare_small_vectors(a, b);
+}
+
+TEST(SmallVector, MethodReserveShrink) {
+  s21::small_vector<int, 4> a{1, 2};
+  a.reserve(3);
+  EXPECT_TRUE(a.is_inline());
+  a.reserve(16);
+  EXPECT_EQ(a.capacity(), 16UL);
+  EXPECT_EQ(a.allocations(), 1UL);
+  a.shrink_to_fit();
+  EXPECT_TRUE(a.is_inline());
+  EXPECT_EQ(a.size(), 2UL);
+  EXPECT_EQ(a[1], 2);
+}
+
+TEST(SmallVector, MethodClear) {
+  s21::small_vector<std::string, 2> a{"a", "b", "c"};
+  a.clear();
+  EXPECT_EQ(a.size(), 0UL);
+  EXPECT_TRUE(a.is_inline());
+}
+
+TEST(SmallVector, MethodInsertErase) {
+  std::vector<int> a{1, 2, 3, 4, 5};
+  s21::small_vector<int, 4> b{1, 2, 3};
+  b.insert(b.end(), 5);
+  b.insert(b.begin() + 3, 4);
+  b.insert(b.begin(), 0);
+  b.erase(b.begin());
+  compare_small_vectors(a, b);
+}
+
+TEST(SmallVector, MethodPopBack) {
+  std::vector<std::string> a{"a"};
+  s21::small_vector<std::string, 1> b{"a", "b"};
+  b.pop_back();
+  compare_small_vectors(a, b);
+}
+
+TEST(SmallVector, MethodSwap) {
+  std::vector<int> a{1, 2, 3, 4, 5};
+  std::vector<int> c{6, 7};
+  s21::small_vector<int, 3> b{1, 2, 3, 4, 5};
+  s21::small_vector<int, 3> d{6, 7};
+  b.swap(d);
+  compare_small_vectors(a, d);
+  compare_small_vectors(c, b);
+}
+
+TEST(SmallVector, MethodInsertMany) {
+  std::vector<std::string> a{"a", "x", "y", "z", "b"};
+  s21::small_vector<std::string, 4> b{"a", "b"};
+  b.insert_many(b.begin() + 1, "x", "y", "z");
+  compare_small_vectors(a, b);
+  b.insert_many_back("c");
+  a.push_back("c");
+  compare_small_vectors(a, b);
+}
+
+TEST(SmallVector, MethodEmplace) {
+  s21::small_vector<std::pair<int, std::string>, 2> a;
+  a.emplace_back(2, "two");
+  a.emplace(a.begin(), 1, "one");
+  a.emplace_back(3, "three");
+  EXPECT_EQ(a.size(), 3UL);
+  EXPECT_EQ(a[0].second, "one");
+  EXPECT_EQ(a[2].first, 3);
+}
+
+struct FailingInline {
+  static int alive;
+  FailingInline(int v) {
+    if (v < 0) throw std::runtime_error("ctor");
+    ++alive;
+  }
+  FailingInline(const FailingInline&) { ++alive; }
+  ~FailingInline() { --alive; }
+};
+int FailingInline::alive = 0;
+
+TEST(SmallVector, MethodEmplaceBackThrows) {
+  {
+    s21::small_vector<FailingInline, 4> v;
+    v.emplace_back(1);
+    EXPECT_THROW(v.emplace_back(-1), std::runtime_error);
+    EXPECT_EQ(v.size(), 1UL);
+    EXPECT_EQ(FailingInline::alive, 1);
+  }
+  EXPECT_EQ(FailingInline::alive, 0);
+}
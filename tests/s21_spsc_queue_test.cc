@@ -0,0 +1,114 @@
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_main_test.h"
+
+TEST(SpscQueue, Capacity) {
+  s21::spsc_queue<int> a(5);
+  EXPECT_EQ(a.capacity(), 8UL);
+  EXPECT_TRUE(a.empty());
+  s21::spsc_queue<int> b(1);
+  EXPECT_EQ(b.capacity(), 2UL);
+}
+
+TEST(SpscQueue, PushPop) {
+  s21::spsc_queue<std::string> a(4);
+  EXPECT_THROW(a.front(), std::logic_error);
+  EXPECT_TRUE(a.try_push("a"));
+  std::string b = "b";
+  EXPECT_TRUE(a.try_push(b));
+  EXPECT_TRUE(a.try_emplace(2, 'c'));
+  a.push(std::string("d"));
+  EXPECT_FALSE(a.try_push("e"));
+  EXPECT_EQ(a.size(), 4UL);
+  EXPECT_EQ(a.front(), "a");
+  a.pop();
+  std::string out;
+  EXPECT_TRUE(a.try_pop(out));
+  EXPECT_EQ(out, "b");
+  EXPECT_TRUE(a.try_pop(out));
+  EXPECT_EQ(out, "cc");
+  EXPECT_EQ(a.size(), 1UL);
+  a.pop();
+  EXPECT_TRUE(a.empty());
+  EXPECT_FALSE(a.try_pop(out));
+  a.pop();
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(SpscQueue, WrapAround) {
+  s21::spsc_queue<int> a(8);
+  int next = 0;
+  int expected = 0;
+  for (int round = 0; round < 100; ++round) {
+    for (int i = 0; i < 5; ++i) EXPECT_TRUE(a.try_push(next++));
+    for (int i = 0; i < 5; ++i) {
+      EXPECT_EQ(a.front(), expected++);
+      a.pop();
+    }
+  }
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(SpscQueue, Batch) {
+  s21::spsc_queue<int> a(8);
+  std::vector<int> in{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  EXPECT_EQ(a.try_push_n(in.begin(), in.size()), 8UL);
+  EXPECT_EQ(a.try_push_n(in.begin(), 1), 0UL);
+  int out[16];
+  EXPECT_EQ(a.try_pop_n(out, 3), 3UL);
+  EXPECT_EQ(out[2], 2);
+  EXPECT_EQ(a.try_push_n(in.begin() + 8, 2), 2UL);
+  EXPECT_EQ(a.try_pop_n(out, 16), 7UL);
+  for (int i = 0; i < 7; ++i) EXPECT_EQ(out[i], i + 3);
+  EXPECT_EQ(a.try_pop_n(out, 16), 0UL);
+}
+
+TEST(SpscQueue, DestroysRemaining) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::spsc_queue<std::shared_ptr<int>> a(4);
+    a.push(counter);
+    a.push(counter);
+    EXPECT_EQ(counter.use_count(), 3);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(SpscQueue, TwoThreads) {
+  const int n = 200000;
+  s21::spsc_queue<int> a(64);
+  std::thread producer([&] {
+    int buf[16];
+    for (int i = 0; i < n;) {
+      if (i % 3 == 0) {
+        a.push(i++);
+      } else {
+        int k = 0;
+        for (; k < 16 && i + k < n; ++k) buf[k] = i + k;
+        int pushed = static_cast<int>(a.try_push_n(buf, k));
+        if (pushed == 0) std::this_thread::yield();
+        i += pushed;
+      }
+    }
+  });
+  long long sum = 0;
+  bool ordered = true;
+  int expected = 0;
+  int buf[32];
+  while (expected < n) {
+    size_t got = a.try_pop_n(buf, 32);
+    if (got == 0) std::this_thread::yield();
+    for (size_t k = 0; k < got; ++k) {
+      ordered = ordered && buf[k] == expected;
+      sum += buf[k];
+      ++expected;
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(ordered);
+  EXPECT_EQ(sum, static_cast<long long>(n) * (n - 1) / 2);
+  EXPECT_TRUE(a.empty());
+}
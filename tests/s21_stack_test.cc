@@ -1,4 +1,6 @@
+#include <memory>
 #include <stack>
+#include <string>
 
 #include "s21_main_test.h"
 
@@ -120,3 +122,59 @@ TEST(Stack, MethodInsertManyBack) {
   EXPECT_EQ(b.size(), 8UL);
   compare_stacks(a, b);
 }
+
+TEST(Stack, MethodEmplace) {
+  s21::stack<std::string> a;
+  a.emplace(3, 'a');
+  std::string s(50, 'b');
+  a.push(std::move(s));
+  EXPECT_EQ(a.top(), std::string(50, 'b'));
+  EXPECT_EQ(a.emplace("c"), "c");
+  EXPECT_EQ(a.size(), 3UL);
+}
+
+TEST(Stack, MoveOnly) {
+  s21::stack<std::unique_ptr<int>> a;
+  a.push(std::make_unique<int>(1));
+  a.emplace(new int(2));
+  a.insert_many_back(std::make_unique<int>(3), std::make_unique<int>(4));
+  for (int i = 4; i >= 1; --i) {
+    EXPECT_EQ(*a.top(), i);
+    a.pop();
+  }
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(Stack, ReserveAndSize) {
+  s21::stack<int> a;
+  a.reserve(1000);
+  size_t cap = a.capacity();
+  EXPECT_GE(cap, 1000UL);
+  for (int i = 0; i < 1000; ++i) {
+    a.push(i);
+    EXPECT_EQ(a.size(), static_cast<size_t>(i + 1));
+  }
+  EXPECT_EQ(a.capacity(), cap);
+  EXPECT_EQ(a.top(), 999);
+  for (int i = 0; i < 500; ++i) a.pop();
+  EXPECT_EQ(a.size(), 500UL);
+  EXPECT_EQ(a.top(), 499);
+}
+
+TEST(Stack, ListContainer) {
+  std::stack<int> a;
+  initialize_std_stack(a);
+  s21::stack<int, s21::list<int>> b{1, 2, 3, 4, 5};
+  s21::stack<int, s21::list<int>> c(b);
+  EXPECT_EQ(c.size(), 5UL);
+  while (!a.empty()) {
+    EXPECT_EQ(a.top(), c.top());
+    a.pop();
+    c.pop();
+  }
+  EXPECT_TRUE(c.empty());
+  c.emplace(7);
+  c.swap(b);
+  EXPECT_EQ(b.top(), 7);
+  EXPECT_EQ(c.size(), 5UL);
+}
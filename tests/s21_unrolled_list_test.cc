@@ -0,0 +1,267 @@
+#include <cstdint>
+#include <list>
+#include <string>
+
+#include "s21_main_test.h"
+
+template <typename T, std::size_t B>
+void compare_unrolled_lists(const std::list<T>& std_list,
+                            const s21::unrolled_list<T, B>& s21_list) {
+  EXPECT_EQ(std_list.size(), s21_list.size());
+  auto it = s21_list.begin();
+  for (const T& el : std_list) {
+    if (it == s21_list.end()) break;
+    EXPECT_EQ(el, *it);
+    ++it;
+  }
+}
+
+TEST(UnrolledList, ConstructorDefault) {
+  s21::unrolled_list<int> a;
+  EXPECT_EQ(a.size(), 0UL);
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.blocks(), 0UL);
+  EXPECT_EQ(a.begin(), a.end());
+}
+
+TEST(UnrolledList, ConstructorParameterized) {
+  s21::unrolled_list<int> a(40);
+  EXPECT_EQ(a.size(), 40UL);
+  EXPECT_EQ(a.blocks(), 3UL);
+  EXPECT_EQ(a.back(), 0);
+}
+
+TEST(UnrolledList, ConstructorCopyMove) {
+  std::list<std::string> a{"a", "b", "c", "d", "e"};
+  s21::unrolled_list<std::string, 64> b{"a", "b", "c", "d", "e"};
+  s21::unrolled_list<std::string, 64> c(b);
+  s21::unrolled_list<std::string, 64> d(std::move(b));
+  EXPECT_TRUE(b.empty());
+  compare_unrolled_lists(a, c);
+  compare_unrolled_lists(a, d);
+  b = c;
+  c = std::move(d);
+  compare_unrolled_lists(a, b);
+  compare_unrolled_lists(a, c);
+}
+
+TEST(UnrolledList, BlockCapacity) {
+  EXPECT_EQ((s21::unrolled_list<int>::block_capacity), 16UL);
+  EXPECT_EQ((s21::unrolled_list<char, 32>::block_capacity), 32UL);
+  EXPECT_EQ((s21::unrolled_list<std::string, 8>::block_capacity), 1UL);
+}
+
+TEST(UnrolledList, BlocksStartOnCacheLine) {
+  s21::unrolled_list<int> a;
+  a.push_back(1);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&*a.begin()) % 64, 0U);
+  s21::unrolled_list<char, 32> b{'x'};
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&*b.begin()) % 64, 0U);
+}
+
+TEST(UnrolledList, IteratorBothWays) {
+  s21::unrolled_list<int, 16> a;
+  std::list<int> b;
+  for (int i = 0; i < 50; ++i) {
+    a.push_back(i);
+    b.push_back(i);
+  }
+  compare_unrolled_lists(b, a);
+  auto it = a.end();
+  for (int i = 49; i >= 0; --i) EXPECT_EQ(*--it, i);
+  EXPECT_EQ(it, a.begin());
+}
+
+TEST(UnrolledList, PushPop) {
+  std::list<int> a;
+  s21::unrolled_list<int, 16> b;
+  for (int i = 0; i < 100; ++i) {
+    if (i % 3) {
+      a.push_front(i);
+      b.push_front(i);
+    } else {
+      a.push_back(i);
+      b.push_back(i);
+    }
+  }
+  compare_unrolled_lists(a, b);
+  for (int i = 0; i < 30; ++i) {
+    a.pop_front();
+    b.pop_front();
+    a.pop_back();
+    b.pop_back();
+  }
+  compare_unrolled_lists(a, b);
+  EXPECT_EQ(a.front(), b.front());
+  EXPECT_EQ(a.back(), b.back());
+}
+
+TEST(UnrolledList, EmptyThrows) {
+  s21::unrolled_list<int> a;
+  EXPECT_THROW(a.front(), std::out_of_range);
+  EXPECT_THROW(a.back(), std::out_of_range);
+  EXPECT_THROW(a.pop_back(), std::out_of_range);
+  EXPECT_THROW(a.pop_front(), std::out_of_range);
+}
+
+TEST(UnrolledList, InsertMiddle) {
+  std::list<int> a;
+  s21::unrolled_list<int, 16> b;
+  for (int i = 0; i < 200; ++i) {
+    auto it_a = a.begin();
+    auto it_b = b.begin();
+    for (int k = 0; k < i / 2; ++k) {
+      ++it_a;
+      ++it_b;
+    }
+    auto res = b.insert(it_b, i);
+    a.insert(it_a, i);
+    EXPECT_EQ(*res, i);
+  }
+  compare_unrolled_lists(a, b);
+  EXPECT_LE(b.blocks(), 200UL / 2);
+}
+
+TEST(UnrolledList, EraseMergesBlocks) {
+  std::list<int> a;
+  s21::unrolled_list<int, 16> b;
+  for (int i = 0; i < 64; ++i) {
+    a.push_back(i);
+    b.push_back(i);
+  }
+  EXPECT_EQ(b.blocks(), 16UL);
+  for (int i = 0; i < 48; ++i) {
+    auto it_a = a.begin();
+    auto it_b = b.begin();
+    for (int k = 0; k < (i * 7) % static_cast<int>(a.size()); ++k) {
+      ++it_a;
+      ++it_b;
+    }
+    a.erase(it_a);
+    b.erase(it_b);
+  }
+  compare_unrolled_lists(a, b);
+  EXPECT_LT(b.blocks(), 16UL);
+  b.erase(b.end());
+  EXPECT_EQ(b.size(), 16UL);
+}
+
+TEST(UnrolledList, NonTrivial) {
+  std::list<std::string> a;
+  s21::unrolled_list<std::string, 128> b;
+  for (int i = 0; i < 100; ++i) {
+    std::string s(20, static_cast<char>('a' + i % 26));
+    auto it_a = a.begin();
+    auto it_b = b.begin();
+    for (int k = 0; k < i / 3; ++k) {
+      ++it_a;
+      ++it_b;
+    }
+    a.insert(it_a, s);
+    b.insert(it_b, s);
+  }
+  compare_unrolled_lists(a, b);
+  for (int i = 0; i < 50; ++i) {
+    a.erase(a.begin());
+    b.erase(b.begin());
+  }
+  compare_unrolled_lists(a, b);
+}
+
+TEST(UnrolledList, Splice) {
+  std::list<int> a{1, 2, 3, 10, 11, 12, 4, 5};
+  s21::unrolled_list<int, 16> b{1, 2, 3, 4, 5};
+  s21::unrolled_list<int, 16> c{10, 11, 12};
+  auto it = b.begin();
+  ++it;
+  ++it;
+  ++it;
+  b.splice(it, c);
+  EXPECT_TRUE(c.empty());
+  EXPECT_EQ(c.blocks(), 0UL);
+  compare_unrolled_lists(a, b);
+  c.push_back(7);
+  b.splice(b.end(), c);
+  b.splice(b.begin(), c);
+  a.push_back(7);
+  compare_unrolled_lists(a, b);
+}
+
+TEST(UnrolledList, Merge) {
+  std::list<int> a{1, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  s21::unrolled_list<int> b{10, 9, 8, 7, 6, 1};
+  s21::unrolled_list<int> c{1, 2, 4, 5, 3};
+  b.sort();
+  c.sort();
+  b.merge(c);
+  EXPECT_TRUE(c.empty());
+  compare_unrolled_lists(a, b);
+}
+
+TEST(UnrolledList, Reverse) {
+  std::list<int> a;
+  s21::unrolled_list<int, 16> b;
+  for (int i = 0; i < 37; ++i) {
+    a.push_front(i);
+    b.push_back(i);
+  }
+  b.reverse();
+  compare_unrolled_lists(a, b);
+  b.push_back(-1);
+  a.push_back(-1);
+  compare_unrolled_lists(a, b);
+}
+
+TEST(UnrolledList, Unique) {
+  std::list<int> a{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  s21::unrolled_list<int, 16> b{10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 1, 2,  3, 6, 6,
+                                4,  4, 7, 8, 9, 2, 3, 4, 5, 6, 7, 10, 1, 1};
+  b.sort();
+  b.unique();
+  compare_unrolled_lists(a, b);
+  b.push_back(10);
+  b.unique();
+  EXPECT_EQ(b.size(), 10UL);
+}
+
+TEST(UnrolledList, SortLarge) {
+  std::list<unsigned> a;
+  s21::unrolled_list<unsigned> b;
+  unsigned x = 7;
+  for (int i = 0; i < 5000; ++i) {
+    x = x * 1103515245u + 12345u;
+    a.push_back(x % 1000);
+    b.push_back(x % 1000);
+  }
+  a.sort(std::greater<unsigned>());
+  b.sort(std::greater<unsigned>());
+  compare_unrolled_lists(a, b);
+  EXPECT_EQ(b.blocks(), (5000 + 15) / 16UL);
+}
+
+TEST(UnrolledList, InsertMany) {
+  std::list<int> a{0, 1, 2, 3, 4, 5, 6, 7, 8};
+  s21::unrolled_list<int, 16> b{0, 4, 8};
+  auto it = b.begin();
+  ++it;
+  it = b.insert_many(it, 1, 2, 3);
+  EXPECT_EQ(*it, 4);
+  ++it;
+  b.insert_many(it, 5, 6, 7);
+  compare_unrolled_lists(a, b);
+  b.insert_many_front(-2, -1);
+  b.insert_many_back(9, 10);
+  a.push_front(-1);
+  a.push_front(-2);
+  a.push_back(9);
+  a.push_back(10);
+  compare_unrolled_lists(a, b);
+}
+
+TEST(UnrolledList, Emplace) {
+  s21::unrolled_list<std::string> a{"x"};
+  auto it = a.emplace(a.begin(), 3, 'a');
+  EXPECT_EQ(*it, "aaa");
+  EXPECT_EQ(a.front(), "aaa");
+  EXPECT_EQ(a.back(), "x");
+}
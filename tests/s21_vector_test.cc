@@ -1,3 +1,9 @@
+#include <cstdint>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 #include "s21_main_test.h"
@@ -205,3 +211,318 @@ TEST(Vector, MethodInsertManyBack) {
   EXPECT_EQ(b.size(), 8UL);
   compare_vectors(a, b);
 }
+
+struct Tracked {
+  static int defaults, copies, moves, alive;
+  int value;
+  Tracked() : value(0) { ++defaults, ++alive; }
+  Tracked(int v) : value(v) { ++alive; }
+  Tracked(const Tracked& o) : value(o.value) { ++copies, ++alive; }
+  Tracked(Tracked&& o) noexcept : value(o.value) { ++moves, ++alive; }
+  Tracked& operator=(const Tracked& o) {
+    value = o.value;
+    ++copies;
+    return *this;
+  }
+  Tracked& operator=(Tracked&& o) noexcept {
+    value = o.value;
+    ++moves;
+    return *this;
+  }
+  ~Tracked() { --alive; }
+  static void reset() { defaults = copies = moves = alive = 0; }
+};
+int Tracked::defaults = 0;
+int Tracked::copies = 0;
+int Tracked::moves = 0;
+int Tracked::alive = 0;
+
+TEST(Vector, GrowthMovesWithoutDefaultConstruct) {
+  Tracked::reset();
+  {
+    s21::vector<Tracked> v;
+    Tracked item(7);
+    for (int i = 0; i < 100; ++i) v.push_back(item);
+    EXPECT_EQ(Tracked::defaults, 0);
+    EXPECT_EQ(Tracked::copies, 100);
+    EXPECT_EQ(Tracked::alive, 101);
+    v.reserve(1000);
+    EXPECT_EQ(Tracked::copies, 100);
+    EXPECT_EQ(v[99].value, 7);
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(Vector, NestedGrowthMovesInnerVectors) {
+  static_assert(std::is_nothrow_move_constructible<s21::vector<int>>::value,
+                "s21::vector must be nothrow movable");
+  Tracked::reset();
+  {
+    s21::vector<s21::vector<Tracked>> v;
+    for (int i = 0; i < 100; ++i) v.push_back(s21::vector<Tracked>(3));
+    EXPECT_GT(v.reallocations(), 1UL);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);
+    EXPECT_EQ(Tracked::alive, 300);
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(Vector, EraseAndPopBackDestroy) {
+  Tracked::reset();
+  {
+    s21::vector<Tracked> v{Tracked(1), Tracked(2), Tracked(3)};
+    EXPECT_EQ(Tracked::alive, 3);
+    v.erase(v.begin());
+    EXPECT_EQ(Tracked::alive, 2);
+    EXPECT_EQ(v[0].value, 2);
+    v.pop_back();
+    EXPECT_EQ(Tracked::alive, 1);
+    v.insert(v.begin(), Tracked(5));
+    EXPECT_EQ(v[0].value, 5);
+    EXPECT_EQ(v[1].value, 2);
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(Vector, PushBackSelfElement) {
+  s21::vector<std::string> v{"a", "b"};
+  for (int i = 0; i < 10; ++i) v.push_back(v[0]);
+  EXPECT_EQ(v.size(), 12UL);
+  EXPECT_EQ(v[11], "a");
+}
+
+TEST(Vector, MethodEmplaceBack) {
+  s21::vector<std::pair<int, std::string>> v;
+  v.emplace_back(1, "one");
+  auto& ref = v.emplace_back(2, "two");
+  EXPECT_EQ(v.size(), 2UL);
+  EXPECT_EQ(ref.second, "two");
+  EXPECT_EQ(v[0].first, 1);
+}
+
+TEST(Vector, MethodEmplace) {
+  std::vector<std::string> a{"a", "b", "c"};
+  s21::vector<std::string> b{"a", "b", "c"};
+  a.emplace(a.begin() + 1, 3, 'x');
+  b.emplace(b.begin() + 1, 3, 'x');
+  a.emplace(a.end(), "end");
+  b.emplace(b.end(), "end");
+  compare_vectors(a, b);
+}
+
+struct ThrowingCtor {
+  static int alive;
+  ThrowingCtor(int v) {
+    if (v < 0) throw std::runtime_error("ctor");
+    ++alive;
+  }
+  ThrowingCtor(const ThrowingCtor&) { ++alive; }
+  ~ThrowingCtor() { --alive; }
+};
+int ThrowingCtor::alive = 0;
+
+TEST(Vector, MethodEmplaceBackThrows) {
+  {
+    s21::vector<ThrowingCtor> v;
+    v.reserve(4);
+    v.emplace_back(1);
+    EXPECT_THROW(v.emplace_back(-1), std::runtime_error);
+    EXPECT_EQ(v.size(), 1UL);
+    EXPECT_EQ(ThrowingCtor::alive, 1);
+  }
+  EXPECT_EQ(ThrowingCtor::alive, 0);
+}
+
+TEST(Vector, MethodPushBackMove) {
+  Tracked::reset();
+  s21::vector<Tracked> v;
+  v.reserve(10);
+  v.push_back(Tracked(1));
+  v.insert(v.begin(), Tracked(2));
+  EXPECT_EQ(Tracked::copies, 0);
+  EXPECT_EQ(v[0].value, 2);
+  EXPECT_EQ(v[1].value, 1);
+}
+
+TEST(Vector, MethodInsertManyInPlace) {
+  Tracked::reset();
+  s21::vector<Tracked> v;
+  v.reserve(10);
+  v.insert_many_back(1, 2);
+  auto it = v.insert_many(v.begin() + 1, 3, 4, 5);
+  EXPECT_EQ(Tracked::copies, 0);
+  EXPECT_EQ(it, v.begin() + 4);
+  int expected[] = {1, 3, 4, 5, 2};
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(v[i].value, expected[i]);
+}
+
+TEST(Vector, MethodInsertManyRealloc) {
+  std::vector<std::string> a{"x", "a", "b", "c", "y"};
+  s21::vector<std::string> b{"x", "y"};
+  b.insert_many(b.begin() + 1, "a", std::string("b"), b[0].substr(0, 0) + "c");
+  compare_vectors(a, b);
+}
+
+TEST(Vector, TrivialInsertEraseShift) {
+  std::vector<int> a;
+  s21::vector<int> b;
+  for (int i = 0; i < 100; ++i) {
+    a.insert(a.begin() + a.size() / 2, i);
+    b.insert(b.begin() + b.size() / 2, i);
+  }
+  for (int i = 0; i < 30; ++i) {
+    a.erase(a.begin() + i);
+    b.erase(b.begin() + i);
+  }
+  compare_vectors(a, b);
+  s21::vector<int> c(b);
+  compare_vectors(a, c);
+}
+
+TEST(Vector, NontemporalCopy) {
+  s21::vector<double>::set_nontemporal_threshold(64);
+  EXPECT_EQ(s21::vector<double>::nontemporal_threshold(), 64UL);
+  std::vector<double> a;
+  s21::vector<double> b;
+  for (int i = 0; i < 1000; ++i) {
+    a.push_back(i * 0.5);
+    b.push_back(i * 0.5);
+  }
+  b.shrink_to_fit();
+  s21::vector<double> c(b);
+  s21::vector<double>::set_nontemporal_threshold(0);
+  compare_vectors(a, b);
+  compare_vectors(a, c);
+}
+
+TEST(Vector, MethodInsertRange) {
+  std::vector<int> a{1, 2, 3};
+  s21::vector<int> b{1, 2, 3};
+  std::vector<int> src{7, 8, 9};
+  a.insert(a.begin() + 1, src.begin(), src.end());
+  b.insert(b.begin() + 1, src.begin(), src.end());
+  compare_vectors(a, b);
+  b.reserve(100);
+  a.insert(a.end(), src.begin(), src.end());
+  b.insert(b.end(), src.begin(), src.end());
+  compare_vectors(a, b);
+  std::vector<int> self(a.begin(), a.begin() + 2);
+  a.insert(a.begin(), self.begin(), self.end());
+  b.insert(b.begin(), b.begin(), b.begin() + 2);
+  compare_vectors(a, b);
+}
+
+TEST(Vector, MethodInsertRangeInputIterator) {
+  std::istringstream in("4 5 6");
+  s21::vector<int> b{1, 2, 3};
+  b.insert(b.begin() + 1, std::istream_iterator<int>(in),
+           std::istream_iterator<int>());
+  std::vector<int> a{1, 4, 5, 6, 2, 3};
+  compare_vectors(a, b);
+}
+
+TEST(Vector, MethodAssign) {
+  std::vector<std::string> a{"x", "y", "z"};
+  s21::vector<std::string> b{"a"};
+  b.assign(a.begin(), a.end());
+  compare_vectors(a, b);
+  a.assign(a.begin(), a.begin() + 1);
+  b.assign(a.begin(), a.end());
+  compare_vectors(a, b);
+  EXPECT_EQ(b.capacity(), 3UL);
+}
+
+TEST(Vector, MethodEraseRange) {
+  std::vector<std::string> a{"a", "b", "c", "d", "e"};
+  s21::vector<std::string> b{"a", "b", "c", "d", "e"};
+  a.erase(a.begin() + 1, a.begin() + 3);
+  auto it = b.erase(b.begin() + 1, b.begin() + 3);
+  EXPECT_EQ(*it, "d");
+  compare_vectors(a, b);
+  b.erase(b.begin(), b.begin());
+  compare_vectors(a, b);
+}
+
+TEST(Vector, MethodEraseIf) {
+  std::vector<int> a;
+  s21::vector<int> b;
+  for (int i = 0; i < 1000; ++i) {
+    if (i % 3) a.push_back(i);
+    b.push_back(i);
+  }
+  EXPECT_EQ(b.erase_if([](int x) { return x % 3 == 0; }), 334UL);
+  compare_vectors(a, b);
+}
+
+TEST(Vector, GrowthUsesFullCapacity) {
+  s21::vector<int> a;
+  a.reserve(4);
+  for (int i = 0; i < 4; ++i) a.push_back(i);
+  EXPECT_EQ(a.capacity(), 4UL);
+  EXPECT_EQ(a.reallocations(), 1UL);
+  a.push_back(4);
+  EXPECT_EQ(a.capacity(), 8UL);
+  EXPECT_EQ(a.reallocations(), 2UL);
+  EXPECT_EQ(a.bytes_moved(), 4 * sizeof(int));
+}
+
+TEST(Vector, GrowthPolicyX1_5) {
+  s21::vector<int, s21::growth_x1_5> a;
+  for (int i = 0; i < 100; ++i) a.push_back(i);
+  std::vector<int> b(a.begin(), a.end());
+  EXPECT_EQ(b.size(), 100UL);
+  EXPECT_EQ(b[99], 99);
+  EXPECT_LE(a.capacity(), 150UL);
+  EXPECT_EQ(a.peak_capacity(), a.capacity());
+}
+
+TEST(Vector, GrowthPolicySizeClass) {
+  s21::vector<char, s21::growth_size_class> a;
+  a.push_back('a');
+  EXPECT_EQ(a.capacity(), 16UL);
+  for (int i = 0; i < 200; ++i) a.push_back('b');
+  EXPECT_EQ(a.capacity() % 32, 0UL);
+  EXPECT_EQ(a.size(), 201UL);
+}
+
+TEST(Vector, ReallocationTelemetry) {
+  s21::vector<double> a;
+  for (int i = 0; i < 1000; ++i) a.push_back(i);
+  size_t peak = a.peak_capacity();
+  EXPECT_EQ(peak, 1024UL);
+  EXPECT_EQ(a.reallocations(), 11UL);
+  EXPECT_EQ(a.bytes_moved(), 1023 * sizeof(double));
+  a.shrink_to_fit();
+  EXPECT_EQ(a.capacity(), 1000UL);
+  EXPECT_EQ(a.peak_capacity(), peak);
+  s21::vector<double> b(std::move(a));
+  EXPECT_EQ(b.reallocations(), 12UL);
+}
+
+TEST(Vector, AlignedMemory) {
+  s21::vector<float, s21::growth_x2, s21::aligned_memory<64>> a;
+  for (int i = 0; i < 1000; ++i) {
+    a.push_back(i);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(a.data()) % 64, 0UL);
+  }
+  a.shrink_to_fit();
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(a.data()) % 64, 0UL);
+  EXPECT_EQ(a[999], 999.0f);
+}
+
+TEST(Vector, HugePageMemory) {
+  using memory = s21::huge_page_memory<64>;
+  s21::vector<int64_t, s21::growth_x2, memory> a;
+  a.push_back(1);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(a.data()) % 64, 0UL);
+  size_t n = 3 * memory::page_size / sizeof(int64_t);
+  a.reserve(n);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(a.data()) % memory::page_size, 0UL);
+  for (size_t i = 1; i < n; ++i) a.push_back(i + 1);
+  EXPECT_EQ(a[0], 1);
+  EXPECT_EQ(a[n - 1], static_cast<int64_t>(n));
+  a.shrink_to_fit();
+  a.clear();
+  EXPECT_EQ(a.size(), 0UL);
+}
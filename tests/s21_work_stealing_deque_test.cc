@@ -0,0 +1,69 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "s21_main_test.h"
+
+TEST(WorkStealingDeque, OwnerIsLifo) {
+  s21::work_stealing_deque<int> a(4);
+  EXPECT_EQ(a.capacity(), 4UL);
+  int out = -1;
+  EXPECT_FALSE(a.pop(out));
+  EXPECT_FALSE(a.steal(out));
+  for (int i = 0; i < 3; ++i) a.push(i);
+  EXPECT_EQ(a.size(), 3UL);
+  EXPECT_TRUE(a.pop(out));
+  EXPECT_EQ(out, 2);
+  EXPECT_TRUE(a.steal(out));
+  EXPECT_EQ(out, 0);
+  EXPECT_TRUE(a.pop(out));
+  EXPECT_EQ(out, 1);
+  EXPECT_TRUE(a.empty());
+  EXPECT_FALSE(a.pop(out));
+}
+
+TEST(WorkStealingDeque, Grows) {
+  s21::work_stealing_deque<int> a(2);
+  int out;
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 100; ++i) a.push(i);
+    EXPECT_TRUE(a.steal(out));
+    EXPECT_EQ(out, 0);
+    for (int i = 99; i > 0; --i) {
+      EXPECT_TRUE(a.pop(out));
+      EXPECT_EQ(out, i);
+    }
+  }
+  EXPECT_GE(a.capacity(), 128UL);
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(WorkStealingDeque, Thieves) {
+  const int n = 100000;
+  const int thieves = 3;
+  s21::work_stealing_deque<int> a(16);
+  std::atomic<bool> done{false};
+  std::vector<long long> sums(thieves + 1, 0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < thieves; ++t)
+    threads.emplace_back([&, t] {
+      int out;
+      while (!done.load() || !a.empty()) {
+        if (a.steal(out))
+          sums[t] += out;
+        else
+          std::this_thread::yield();
+      }
+    });
+  int out;
+  for (int i = 0; i < n; ++i) {
+    a.push(i);
+    if (i % 3 == 0 && a.pop(out)) sums[thieves] += out;
+  }
+  while (a.pop(out)) sums[thieves] += out;
+  done.store(true);
+  for (auto& t : threads) t.join();
+  long long total = 0;
+  for (long long s : sums) total += s;
+  EXPECT_EQ(total, static_cast<long long>(n) * (n - 1) / 2);
+}